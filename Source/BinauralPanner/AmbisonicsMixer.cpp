@@ -0,0 +1,445 @@
+/*
+  ==============================================================================
+
+    AmbisonicsMixer.cpp
+
+  ==============================================================================
+*/
+
+#include "AmbisonicsMixer.h"
+#include "VectorOps.h"
+
+namespace
+{
+  // Points of the grid the filters are fitted over, and the fit's regularisation, which
+  // keeps them tame below the lowest elevation the set covers
+  const int cFitGridSize = 512;
+  const double cFitRegularisation = 1e-3;
+  // Frequency per order up to which the harmonics follow the interaural delays, c / (2 pi r)
+  // for a head radius r of 8.75 cm
+  const float cAliasingFreqPerOrder = 624.f;
+
+  // AmbiX axes: x to the front, y to the left, z up; azimuth turns to the right
+  Point3Cartesian<float> getDirection(float azimuth, float elevation)
+  {
+    const auto a = deg2rad(azimuth), e = deg2rad(elevation);
+    return {std::cos(e) * std::cos(a), -std::cos(e) * std::sin(a), std::sin(e)};
+  }
+}
+
+AmbisonicsMixer::AmbisonicsMixer()
+: mOrder(1)
+, mSampleRate(44100.)
+, mBlockSize(0)
+, mEnable(false)
+, mCrossoverFreq(150.f)
+, mHRTFContainer(BinauralPanner::getDefaultHRTFOptions())
+, mYaw(0.f)
+, mPitch(0.f)
+, mRoll(0.f)
+, mPrevYaw(0.f)
+, mPrevPitch(0.f)
+, mPrevRoll(0.f)
+, mRotating(false)
+, mNumPartitions(1)
+, mNumBins(0)
+, mPartitionPosition(0)
+, mNewestHalf(0)
+, mNewestInputDFT(0)
+{
+}
+
+AmbisonicsMixer::~AmbisonicsMixer()
+{
+}
+
+void AmbisonicsMixer::setOrder(int order)
+{
+  mOrder = jlimit(1, SphericalHarmonics::cMaxOrder, order);
+  for(auto& source : mSources)
+    source.prevAzimuth = source.prevElevation = -1.f;
+  if(mEnable)
+    prepareDecoder();
+}
+
+void AmbisonicsMixer::setNumSources(int numSources)
+{
+  mSources.resize(jmax(0, numSources));
+}
+
+bool AmbisonicsMixer::loadHRTFSet(const File& file, const HRTFDatabase::LoadOptions& options)
+{
+  if(!mHRTFContainer.loadHRTFSet(file, options))
+    return false;
+
+  if(mEnable)
+    prepareDecoder();
+  return true;
+}
+
+void AmbisonicsMixer::setPosition(int source, float azimuth, float elevation)
+{
+  jassert(isPositiveAndBelow(source, getNumSources()));
+  mSources[source].azimuth = jlimit<float>(-180., 180., azimuth);
+  mSources[source].elevation = jlimit<float>(-90., 90., elevation);
+}
+
+void AmbisonicsMixer::setSceneRotation(float yaw, float pitch, float roll)
+{
+  mYaw = yaw;
+  mPitch = pitch;
+  mRoll = roll;
+}
+
+void AmbisonicsMixer::setCrossoverFreq(float freq)
+{
+  mCrossoverFreq = freq;
+  mLowFreqCrossover.setFrequency(freq);
+  for(auto& crossover : mBusCrossovers)
+    crossover.setFrequency(freq);
+}
+
+void AmbisonicsMixer::prepareToPlay (double sampleRate, int estimatedSamplesPerBlock)
+{
+  mSampleRate = sampleRate;
+  mBlockSize = estimatedSamplesPerBlock;
+
+  mLowFreqCrossover.prepareToPlay(sampleRate);
+  for(auto& crossover : mBusCrossovers)
+    crossover.prepareToPlay(sampleRate);
+  setCrossoverFreq(mCrossoverFreq);
+  mLowFreqBuffer.setSize(1, estimatedSamplesPerBlock);
+
+  mLowFreqDelay.prepare((float) BinauralPanner::cPartitionSize);
+  mLowFreqDelay.setDelay((float) BinauralPanner::cPartitionSize);
+  mLowFreqDelay.reset();
+
+  prepareDecoder();
+  mEnable = true;
+}
+
+void AmbisonicsMixer::prepareDecoder()
+{
+  const auto partitionSize = BinauralPanner::cPartitionSize;
+  const auto nfft = 2 * partitionSize;
+  const auto numChannels = getNumChannels();
+
+  mBus.setSize(numChannels, mBlockSize);
+  mRotatedBus.setSize(numChannels, mBlockSize);
+  mRotation.reset(new SphericalHarmonics::Rotation(mOrder));
+  mRotationMatrix.assign(numChannels * numChannels, 0.f);
+  for(int i = 0; i < numChannels; ++i)
+    mRotationMatrix[i * (numChannels + 1)] = 1.f;
+  mTargetRotationMatrix = mRotationMatrix;
+  mPrevYaw = mPrevPitch = mPrevRoll = 0.f;
+  mRotating = false;
+
+  std::vector<float> filters[2];
+  const auto filterLength = fitFilters(filters);
+
+  // partitioned as in HRIRFilter
+  mNumPartitions = jmax(1, (filterLength + partitionSize - 1) / partitionSize);
+  mNumBins = nfft / 2 + 1;
+  mFFT = FFT::create(nfft);
+  std::vector<float> zeroPaddedIR(nfft);
+  for(int n = 0; n < SphericalHarmonics::cMaxChannels; ++n)
+  {
+    const auto used = n < numChannels;
+    mInput[n].assign(used ? nfft : 0, 0.f);
+    mInputDFTs[n].assign(used ? mNumPartitions * mNumBins : 0, {});
+    for(int ear = 0; ear < 2; ++ear)
+    {
+      auto& tf = mTransferFunction[n][ear];
+      tf.assign(used ? mNumPartitions * mNumBins : 0, {});
+      for(int k = 0; used && k < mNumPartitions; ++k)
+      {
+        const auto start = jmin(k * partitionSize, filterLength);
+        const auto end = jmin(start + partitionSize, filterLength);
+        const auto* filter = filters[ear].data() + n * filterLength;
+        std::fill(zeroPaddedIR.begin(), zeroPaddedIR.end(), 0.f);
+        std::copy(filter + start, filter + end, zeroPaddedIR.begin());
+        mFFT->fft(zeroPaddedIR.data(), &tf[k * mNumBins]);
+      }
+    }
+  }
+  for(int ear = 0; ear < 2; ++ear)
+  {
+    mBusDFT[ear].resize(mNumBins);
+    mBusOutput[ear].assign(nfft, 0.f);
+  }
+  mPartitionPosition = 0;
+  mNewestHalf = 0;
+  mNewestInputDFT = 0;
+}
+
+int AmbisonicsMixer::fitFilters(std::vector<float> (&filters)[2])
+{
+  const auto numChannels = getNumChannels();
+  const auto irLength = mHRTFContainer.getIRLength();
+  const auto maxDelay = mHRTFContainer.getMaxDelay();
+  const auto hasDelays = maxDelay > 0.f;
+  auto filterLength = irLength + (hasDelays ? (int) std::ceil(maxDelay) + 3 : 0);
+
+  // the set's HRIRs over the grid, leaving out directions it doesn't cover
+  std::vector<double> harmonics;
+  std::vector<float> irs[2]; // [ear], [point][tap]
+  std::vector<float> delays[2]; // [ear][point]
+  for(const auto& d : SphericalHarmonics::getSphereGrid(cFitGridSize))
+  {
+    const auto p = cartesianToInteraural(Point3Cartesian<float> {-d.y, d.x, d.z});
+    if(!mHRTFContainer.updateHRIR(rad2deg(p.azimuth), rad2deg(p.elevation)))
+      continue;
+
+    const auto& hrir = mHRTFContainer.hrir();
+    irs[0].insert(irs[0].end(), hrir.leftEarIR.begin(), hrir.leftEarIR.end());
+    irs[1].insert(irs[1].end(), hrir.rightEarIR.begin(), hrir.rightEarIR.end());
+    delays[0].push_back(hrir.leftEarDelay);
+    delays[1].push_back(hrir.rightEarDelay);
+
+    float y[SphericalHarmonics::cMaxChannels];
+    SphericalHarmonics::evaluate(mOrder, d, y);
+    harmonics.insert(harmonics.end(), y, y + numChannels);
+  }
+  const auto numPoints = (int) delays[0].size();
+  std::vector<double> fit;
+  SphericalHarmonics::pseudoInverse(harmonics, numPoints, numChannels, cFitRegularisation, fit);
+
+  // each channel's filter is its row of the fit applied to the HRIRs, with their own
+  // delays or, if aligned, all with the same one
+  auto fitHRIRs = [&](bool aligned, float alignedDelay, int length, std::vector<float> (&out)[2])
+  {
+    std::vector<float> ir(length);
+    for(int ear = 0; ear < 2; ++ear)
+    {
+      out[ear].assign(numChannels * length, 0.f);
+      for(int q = 0; q < numPoints; ++q)
+      {
+        const auto* measured = irs[ear].data() + q * irLength;
+        if(hasDelays)
+          FractionalDelay::delayImpulseResponse(measured, irLength, aligned ? alignedDelay : delays[ear][q], ir.data(), length);
+        else
+          std::copy(measured, measured + irLength, ir.begin());
+        for(int n = 0; n < numChannels; ++n)
+        {
+          const auto weight = (float) fit[n * numPoints + q];
+          float* filter = out[ear].data() + n * length;
+          for(int i = 0; i < length; ++i)
+            filter[i] += weight * ir[i];
+        }
+      }
+    }
+  };
+
+  if(!hasDelays)
+  {
+    fitHRIRs(false, 0.f, filterLength, filters);
+    return filterLength;
+  }
+
+  // Above a frequency that rises with the order, the interaural delays change too fast over
+  // directions for the harmonics to follow, and the fit would average the HRIRs out of phase
+  // and lose most of their level. Up there the filters are fitted to the HRIRs all aligned to
+  // their mean delay instead, which keeps the level and gives up the time difference, which
+  // matters little at those frequencies. The crossover's tails take another partition.
+  auto meanDelay = 0.f;
+  for(const auto& earDelays : delays)
+    for(auto delay : earDelays)
+      meanDelay += delay;
+  meanDelay /= jmax(1, 2 * numPoints);
+  filterLength += BinauralPanner::cPartitionSize;
+
+  std::vector<float> aligned[2];
+  fitHRIRs(false, 0.f, filterLength, filters);
+  fitHRIRs(true, meanDelay, filterLength, aligned);
+  for(int ear = 0; ear < 2; ++ear)
+  {
+    for(int n = 0; n < numChannels; ++n)
+    {
+      Crossover crossover;
+      crossover.prepareToPlay(mSampleRate);
+      crossover.setFrequency(cAliasingFreqPerOrder * mOrder);
+      float* filter = filters[ear].data() + n * filterLength;
+      float* high = aligned[ear].data() + n * filterLength;
+      crossover.processLowBand(filter, filter, filterLength);
+      crossover.processHighBand(high, high, filterLength);
+      for(int i = 0; i < filterLength; ++i)
+        filter[i] += high[i];
+    }
+  }
+  return filterLength;
+}
+
+void AmbisonicsMixer::processBlock(AudioBuffer<float> &buffer)
+{
+  if(!mEnable)
+    return;
+
+  const auto numSamples = buffer.getNumSamples();
+  const auto numChannels = getNumChannels();
+  jassert(buffer.getNumChannels() >= jmax(2, getNumSources()));
+
+  // the only cost per source
+  mBus.clear(0, numSamples);
+  for(int i = 0; i < getNumSources(); ++i)
+  {
+    auto& source = mSources[i];
+    if(source.azimuth != source.prevAzimuth || source.elevation != source.prevElevation)
+    {
+      SphericalHarmonics::evaluate(mOrder, getDirection(source.azimuth, source.elevation), source.targetGains);
+      // a new source starts where it is
+      if(source.prevAzimuth == -1.f && source.prevElevation == -1.f)
+        std::copy(source.targetGains, source.targetGains + numChannels, source.gains);
+      source.prevAzimuth = source.azimuth;
+      source.prevElevation = source.elevation;
+    }
+    encode(source, buffer.getReadPointer(i), numSamples);
+    std::copy(source.targetGains, source.targetGains + numChannels, source.gains);
+  }
+
+  // the omnidirectional channel is the plain sum of the sources, whose low band isn't spatialised
+  auto* low = mLowFreqBuffer.getWritePointer(0);
+  mLowFreqCrossover.processLowBand(mBus.getReadPointer(0), low, numSamples);
+  mLowFreqDelay.process(low, numSamples);
+  for(int n = 0; n < numChannels; ++n)
+    mBusCrossovers[n].processHighBand(mBus.getReadPointer(n), mBus.getWritePointer(n), numSamples);
+
+  updateRotation();
+  const auto& bus = mRotating ? mRotatedBus : mBus;
+  if(mRotating)
+    rotate(numSamples);
+
+  // as in BinauralMixer
+  const auto partitionSize = BinauralPanner::cPartitionSize;
+  const auto busScale = 2.f / (2 * partitionSize);
+  float* outL = buffer.getWritePointer(0);
+  float* outR = buffer.getWritePointer(1);
+  for(int pos = 0; pos < numSamples;)
+  {
+    const auto n = jmin(numSamples - pos, partitionSize - mPartitionPosition);
+    for(int c = 0; c < numChannels; ++c)
+    {
+      const auto* samples = bus.getReadPointer(c) + pos;
+      std::copy(samples, samples + n, mInput[c].data() + mNewestHalf * partitionSize + mPartitionPosition);
+    }
+
+    const float* busL = mBusOutput[0].data() + partitionSize + mPartitionPosition;
+    const float* busR = mBusOutput[1].data() + partitionSize + mPartitionPosition;
+    for(int i = 0; i < n; ++i)
+    {
+      outL[pos + i] = (low[pos + i] + busScale * busL[i]) * 0.5f;
+      outR[pos + i] = (low[pos + i] + busScale * busR[i]) * 0.5f;
+    }
+
+    mPartitionPosition += n;
+    pos += n;
+    if(mPartitionPosition == partitionSize)
+    {
+      processPartition();
+      mPartitionPosition = 0;
+      mNewestHalf ^= 1;
+    }
+  }
+}
+
+void AmbisonicsMixer::encode(const Source& source, const float* input, int numSamples)
+{
+  // gains glide from where the last block left them
+  const auto step = 1.f / numSamples;
+  for(int n = 0; n < getNumChannels(); ++n)
+  {
+    const auto gain = source.gains[n];
+    const auto delta = (source.targetGains[n] - gain) * step;
+    float* bus = mBus.getWritePointer(n);
+    for(int i = 0; i < numSamples; ++i)
+      bus[i] += (gain + delta * (i + 1)) * input[i];
+  }
+}
+
+void AmbisonicsMixer::updateRotation()
+{
+  std::copy(mTargetRotationMatrix.begin(), mTargetRotationMatrix.end(), mRotationMatrix.begin());
+  if(mYaw == mPrevYaw && mPitch == mPrevPitch && mRoll == mPrevRoll)
+  {
+    // nothing to do once the scene is back where it started
+    mRotating = mYaw != 0.f || mPitch != 0.f || mRoll != 0.f;
+    return;
+  }
+
+  // directions turn by yaw about z, then pitch about y, then roll about x, see getDirection()
+  const auto cy = std::cos(deg2rad(mYaw)), sy = std::sin(deg2rad(mYaw));
+  const auto cp = std::cos(deg2rad(mPitch)), sp = std::sin(deg2rad(mPitch));
+  const auto cr = std::cos(deg2rad(mRoll)), sr = std::sin(deg2rad(mRoll));
+  const float yaw[3][3] = {{cy, sy, 0.f}, {-sy, cy, 0.f}, {0.f, 0.f, 1.f}};
+  const float pitch[3][3] = {{cp, 0.f, -sp}, {0.f, 1.f, 0.f}, {sp, 0.f, cp}};
+  const float roll[3][3] = {{1.f, 0.f, 0.f}, {0.f, cr, -sr}, {0.f, sr, cr}};
+  float pitchYaw[3][3], rotation[3][3];
+  for(int i = 0; i < 3; ++i)
+    for(int j = 0; j < 3; ++j)
+      pitchYaw[i][j] = pitch[i][0] * yaw[0][j] + pitch[i][1] * yaw[1][j] + pitch[i][2] * yaw[2][j];
+  for(int i = 0; i < 3; ++i)
+    for(int j = 0; j < 3; ++j)
+      rotation[i][j] = roll[i][0] * pitchYaw[0][j] + roll[i][1] * pitchYaw[1][j] + roll[i][2] * pitchYaw[2][j];
+
+  jassert((int) mTargetRotationMatrix.size() == getNumChannels() * getNumChannels());
+  mRotation->getMatrix(rotation, mTargetRotationMatrix.data());
+  mPrevYaw = mYaw;
+  mPrevPitch = mPitch;
+  mPrevRoll = mRoll;
+  mRotating = true;
+}
+
+void AmbisonicsMixer::rotate(int numSamples)
+{
+  // the matrix glides over the block like the sources' gains; each order only mixes within itself
+  const auto numChannels = getNumChannels();
+  const auto step = 1.f / numSamples;
+  for(int row = 0; row < numChannels; ++row)
+  {
+    float* out = mRotatedBus.getWritePointer(row);
+    std::fill(out, out + numSamples, 0.f);
+    const auto order = SphericalHarmonics::getOrder(row);
+    for(int col = order * order; col < (order + 1) * (order + 1); ++col)
+    {
+      const auto gain = mRotationMatrix[row * numChannels + col];
+      const auto delta = (mTargetRotationMatrix[row * numChannels + col] - gain) * step;
+      const float* in = mBus.getReadPointer(col);
+      if(delta == 0.f)
+      {
+        for(int i = 0; i < numSamples; ++i)
+          out[i] += gain * in[i];
+      }
+      else
+      {
+        for(int i = 0; i < numSamples; ++i)
+          out[i] += (gain + delta * (i + 1)) * in[i];
+      }
+    }
+  }
+}
+
+void AmbisonicsMixer::processPartition()
+{
+  const auto partitionSize = BinauralPanner::cPartitionSize;
+  mNewestInputDFT = (mNewestInputDFT + 1) % mNumPartitions;
+  for(auto& dft : mBusDFT)
+    std::fill(dft.begin(), dft.end(), std::complex<float>());
+
+  // one forward transform per channel of the bus, however many sources it carries
+  for(int c = 0; c < getNumChannels(); ++c)
+  {
+    const auto* ring = mInput[c].data();
+    mFFT->fft(ring + (mNewestHalf ^ 1) * partitionSize, ring + mNewestHalf * partitionSize,
+              &mInputDFTs[c][mNewestInputDFT * mNumBins]);
+    for(int ear = 0; ear < 2; ++ear)
+    {
+      for(int k = 0; k < mNumPartitions; ++k)
+      {
+        const auto frame = (mNewestInputDFT - k + mNumPartitions) % mNumPartitions;
+        VectorOps::complexMultiplyAdd(&mInputDFTs[c][frame * mNumBins], &mTransferFunction[c][ear][k * mNumBins],
+                                      mBusDFT[ear].data(), mNumBins);
+      }
+    }
+  }
+
+  mFFT->ifftPair(mBusDFT[0].data(), mBusDFT[1].data(), mBusOutput[0].data(), mBusOutput[1].data());
+}
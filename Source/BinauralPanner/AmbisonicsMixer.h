@@ -0,0 +1,113 @@
+/*
+  ==============================================================================
+
+    AmbisonicsMixer.h
+
+  ==============================================================================
+*/
+
+#ifndef AMBISONICSMIXER_H_INCLUDED
+#define AMBISONICSMIXER_H_INCLUDED
+
+#include "BinauralPanner.h"
+#include "SphericalHarmonics.h"
+
+/** Renders any number of mono sources to binaural through an Ambisonic bus of up to third order.
+    A source only costs its encoding gains, one per channel of the bus, while the binaural
+    rendering runs once for the whole bus, whatever the number of sources: each channel of the
+    bus is filtered through a pair of spherical-harmonic filters, fitted to the HRIRs of the set
+    over a grid of directions, and summed in the frequency domain as in BinauralMixer.
+    The whole scene can be turned, e.g. against a head tracker, by a rotation of the bus.
+    Coarser than BinauralMixer: the lower the order, the more the HRTFs are smoothed over
+    directions, mostly at high frequencies.
+*/
+class AmbisonicsMixer
+{
+public:
+  AmbisonicsMixer();
+  ~AmbisonicsMixer();
+
+  // 1 to SphericalHarmonics::cMaxOrder. Refits the filters, call while not processing.
+  void setOrder(int order);
+  int getOrder() const { return mOrder; }
+
+  // Allocates, call while not processing. New sources start straight ahead.
+  void setNumSources(int numSources);
+  int getNumSources() const { return (int) mSources.size(); }
+
+  void prepareToPlay (double sampleRate, int estimatedSamplesPerBlock);
+  // As for BinauralMixer: one source per channel, the binaural mix replaces the first two
+  void processBlock(AudioBuffer<float> &buffer);
+
+  // Delay in samples added by processBlock(), for the host to compensate
+  int getLatencySamples() const { return BinauralPanner::cPartitionSize; }
+
+  // Moves glide over the next block
+  void setPosition(int source, float azimuth, float elevation);
+  // Turns every source by the same angles in degrees, applied in this order: yaw to the right,
+  // pitch up and roll to the right, the way BinauralPanner's azimuth and elevation turn.
+  // For head tracking pass the opposite of the head's rotation.
+  void setSceneRotation(float yaw, float pitch, float roll);
+  void setCrossoverFreq(float freq);
+
+  // Fits the filters to another set, see BinauralPanner::loadHRTFSet(). Call while not processing.
+  bool loadHRTFSet(const File& file, const HRTFDatabase::LoadOptions& options = BinauralPanner::getDefaultHRTFOptions());
+
+private:
+  struct Source
+  {
+    float azimuth = 0.f, elevation = 0.f;
+    float prevAzimuth = -1.f, prevElevation = -1.f;
+    float gains[SphericalHarmonics::cMaxChannels]; // reached by the end of the last block
+    float targetGains[SphericalHarmonics::cMaxChannels];
+  };
+
+  void prepareDecoder();
+  // Fits a pair of filters per channel to the set's HRIRs: filters[ear] holds them one after
+  // the other. Returns their length.
+  int fitFilters(std::vector<float> (&filters)[2]);
+  void encode(const Source& source, const float* input, int numSamples);
+  void updateRotation();
+  void rotate(int numSamples);
+  void processPartition();
+  int getNumChannels() const { return SphericalHarmonics::getNumChannels(mOrder); }
+
+  int mOrder;
+  std::vector<Source> mSources;
+
+  double mSampleRate;
+  int mBlockSize;
+  bool mEnable;
+  float mCrossoverFreq;
+  HRTFContainer mHRTFContainer; // only for fitting the filters
+
+  // Scene rotation, with the matrix reached by the end of the last block and the one to glide to
+  float mYaw, mPitch, mRoll;
+  float mPrevYaw, mPrevPitch, mPrevRoll;
+  std::unique_ptr<SphericalHarmonics::Rotation> mRotation;
+  std::vector<float> mRotationMatrix, mTargetRotationMatrix;
+  bool mRotating;
+
+  AudioSampleBuffer mBus; // the encoded sources, one channel per harmonic
+  AudioSampleBuffer mRotatedBus;
+  Crossover mBusCrossovers[SphericalHarmonics::cMaxChannels]; // high-pass only
+
+  // Partition clock and spectra as in BinauralMixer, one input per channel of the bus
+  std::unique_ptr<FFT> mFFT;
+  int mNumPartitions;
+  int mNumBins;
+  int mPartitionPosition;
+  int mNewestHalf;
+  int mNewestInputDFT;
+  std::vector<float> mInput[SphericalHarmonics::cMaxChannels];
+  ComplexVector<float> mInputDFTs[SphericalHarmonics::cMaxChannels];
+  ComplexVector<float> mTransferFunction[SphericalHarmonics::cMaxChannels][2]; // [channel][ear], each [partition][bin]
+  ComplexVector<float> mBusDFT[2];
+  std::vector<float> mBusOutput[2];
+
+  Crossover mLowFreqCrossover;
+  AudioSampleBuffer mLowFreqBuffer; // the omnidirectional channel's low band
+  FractionalDelay mLowFreqDelay;
+};
+
+#endif  // AMBISONICSMIXER_H_INCLUDED
@@ -0,0 +1,333 @@
+/*
+  ==============================================================================
+
+    BinauralMixer.cpp
+
+  ==============================================================================
+*/
+
+#include "BinauralMixer.h"
+#include "VectorOps.h"
+
+BinauralMixer::BinauralMixer()
+: mSampleRate(44100.)
+, mBlockSize(0)
+, mEnable(false)
+, mCrossoverFreq(150.f)
+, mHRTFOptions(BinauralPanner::getDefaultHRTFOptions())
+, mLookupAzimuthStep(0.)
+, mLookupElevationStep(0.)
+, mDelaysInFilters(false)
+, mEarDelays(EarDelays::None)
+, mNumPartitions(1)
+, mNumBins(0)
+, mPartitionPosition(0)
+, mNewestHalf(0)
+, mNewestInputDFT(0)
+{
+}
+
+BinauralMixer::~BinauralMixer()
+{
+}
+
+void BinauralMixer::setNumSources(int numSources)
+{
+  numSources = jmax(0, numSources);
+  const bool adding = numSources > getNumSources();
+  mSources.resize(jmin<size_t>(mSources.size(), numSources));
+
+  while(getNumSources() < numSources)
+  {
+    mSources.emplace_back(new Source(mHRTFOptions));
+    auto& container = mSources.back()->hrtfContainer;
+    if(mHRTFFile != File::nonexistent)
+      container.loadHRTFSet(mHRTFFile, mHRTFOptions);
+    if(mLookupAzimuthStep > 0. && mLookupElevationStep > 0.)
+      container.setLookupTableResolution(mLookupAzimuthStep, mLookupElevationStep);
+  }
+
+  // the first source of a set decides how the filters are laid out, so start over
+  if(adding && mEnable)
+    prepareFilters();
+}
+
+bool BinauralMixer::loadHRTFSet(const File& file, const HRTFDatabase::LoadOptions& options)
+{
+  // the set is loaded once and shared, so if it loads for one source it loads for all
+  for(auto& source : mSources)
+    if(!source->hrtfContainer.loadHRTFSet(file, options))
+      return false;
+
+  mHRTFFile = file;
+  mHRTFOptions = options;
+  if(mEnable)
+    prepareFilters();
+  return true;
+}
+
+void BinauralMixer::setHRTFLookupResolution(double azimuthStep, double elevationStep)
+{
+  mLookupAzimuthStep = azimuthStep;
+  mLookupElevationStep = elevationStep;
+  for(auto& source : mSources)
+  {
+    source->hrtfContainer.setLookupTableResolution(azimuthStep, elevationStep);
+    source->prevAzimuth = source->prevElevation = -1.f;
+  }
+}
+
+void BinauralMixer::setDelaysInFilters(bool delaysInFilters)
+{
+  mDelaysInFilters = delaysInFilters;
+  if(mEnable)
+    prepareFilters();
+}
+
+void BinauralMixer::setPosition(int source, float azimuth, float elevation)
+{
+  jassert(isPositiveAndBelow(source, getNumSources()));
+  mSources[source]->azimuth = jlimit<float>(-180., 180., azimuth);
+  mSources[source]->elevation = jlimit<float>(-90., 90., elevation);
+}
+
+void BinauralMixer::setCrossoverFreq(float freq)
+{
+  mCrossoverFreq = freq;
+  mLowFreqCrossover.setFrequency(freq);
+  for(auto& source : mSources)
+    source->crossover.setFrequency(freq);
+}
+
+void BinauralMixer::prepareToPlay (double sampleRate, int estimatedSamplesPerBlock)
+{
+  mSampleRate = sampleRate;
+  mBlockSize = estimatedSamplesPerBlock;
+
+  // the crossover only picks up the sample rate when its frequency is set
+  mLowFreqCrossover.prepareToPlay(sampleRate);
+  mLowFreqCrossover.setFrequency(mCrossoverFreq);
+  mLowFreqBuffer.setSize(1, estimatedSamplesPerBlock);
+
+  mLowFreqDelay.prepare((float) BinauralPanner::cPartitionSize);
+  mLowFreqDelay.setDelay((float) BinauralPanner::cPartitionSize);
+  mLowFreqDelay.reset();
+
+  prepareFilters();
+  mEnable = true;
+}
+
+void BinauralMixer::prepareFilters()
+{
+  const auto partitionSize = BinauralPanner::cPartitionSize;
+  const auto nfft = 2 * partitionSize;
+
+  // every source uses the same set, so its containers agree on the partitions
+  const auto maxDelay = mSources.empty() ? 0.f : mSources.front()->hrtfContainer.getMaxDelay();
+  if(maxDelay <= 0.f)
+    mEarDelays = EarDelays::None;
+  else
+    mEarDelays = mDelaysInFilters ? EarDelays::InFilters : EarDelays::DelayLines;
+
+  for(auto& source : mSources)
+    source->hrtfContainer.prepare(nfft, mEarDelays == EarDelays::InFilters);
+  mNumPartitions = mSources.empty() ? 1 : jmax(1, mSources.front()->hrtfContainer.getNumPartitions());
+  mNumBins = nfft / 2 + 1;
+  mFFT = FFT::create(nfft);
+
+  for(auto& dft : mFilteredDFT)
+    dft.resize(mNumBins);
+  for(int ear = 0; ear < 2; ++ear)
+  {
+    mBusDFT[ear].resize(mNumBins);
+    mBusOutput[ear].assign(nfft, 0.f);
+  }
+  mPartitionPosition = 0;
+  mNewestHalf = 0;
+  mNewestInputDFT = 0;
+
+  for(auto& source : mSources)
+    prepareSource(*source);
+}
+
+void BinauralMixer::prepareSource(Source& source)
+{
+  const auto partitionSize = BinauralPanner::cPartitionSize;
+  auto& container = source.hrtfContainer;
+
+  source.crossover.prepareToPlay(mSampleRate);
+  source.crossover.setFrequency(mCrossoverFreq);
+  source.ears.setSize(2, mBlockSize);
+
+  for(int ear = 0; ear < 2; ++ear)
+  {
+    source.delays[ear].prepare(container.getMaxDelay());
+    source.delays[ear].reset();
+    source.input[ear].assign(ear < getNumEarInputs() ? 2 * partitionSize : 0, 0.f);
+    source.inputDFTs[ear].assign(ear < getNumEarInputs() ? mNumPartitions * mNumBins : 0, {});
+    for(auto& tf : source.transferFunction)
+      tf[ear].assign(mNumPartitions * mNumBins, {});
+  }
+  source.crossfadePending = false;
+
+  // start from the current position straight away, later moves are prepared in the background
+  updatePosition(source, false);
+}
+
+void BinauralMixer::processBlock(AudioBuffer<float> &buffer)
+{
+  if(!mEnable)
+    return;
+
+  const auto numSamples = buffer.getNumSamples();
+  const auto numSources = getNumSources();
+  jassert(buffer.getNumChannels() >= jmax(2, numSources));
+
+  // the low bands are mixed without spatialisation, so one crossover splits their sum
+  mLowFreqBuffer.clear(0, 0, numSamples);
+  for(int i = 0; i < numSources; ++i)
+    mLowFreqBuffer.addFrom(0, 0, buffer, i, 0, numSamples);
+  auto* low = mLowFreqBuffer.getWritePointer(0);
+  mLowFreqCrossover.processLowBand(low, low, numSamples);
+  mLowFreqDelay.process(low, numSamples);
+
+  // each source's high band, through its ears' delays if the set has them
+  for(int i = 0; i < numSources; ++i)
+  {
+    auto& source = *mSources[i];
+    if(source.azimuth != source.prevAzimuth || source.elevation != source.prevElevation)
+      updatePosition(source, true);
+    if(const auto* hrtf = source.hrtfContainer.getNewHRTF())
+      setFilters(source, *hrtf);
+
+    source.crossover.processHighBand(buffer.getReadPointer(i), source.ears.getWritePointer(0), numSamples);
+    if(mEarDelays == EarDelays::DelayLines)
+    {
+      source.ears.copyFrom(1, 0, source.ears, 0, 0, numSamples);
+      source.delays[0].process(source.ears.getWritePointer(0), numSamples);
+      source.delays[1].process(source.ears.getWritePointer(1), numSamples);
+    }
+  }
+
+  // all sources share one partition clock, and the bus plays out one partition late like HRIRFilter
+  const auto partitionSize = BinauralPanner::cPartitionSize;
+  const auto busScale = 2.f / (2 * partitionSize);
+  float* outL = buffer.getWritePointer(0);
+  float* outR = buffer.getWritePointer(1);
+  for(int pos = 0; pos < numSamples;)
+  {
+    const auto n = jmin(numSamples - pos, partitionSize - mPartitionPosition);
+    for(auto& source : mSources)
+      for(int ear = 0; ear < getNumEarInputs(); ++ear)
+      {
+        const auto* ears = source->ears.getReadPointer(ear) + pos;
+        std::copy(ears, ears + n, source->input[ear].data() + mNewestHalf * partitionSize + mPartitionPosition);
+      }
+
+    const float* busL = mBusOutput[0].data() + partitionSize + mPartitionPosition;
+    const float* busR = mBusOutput[1].data() + partitionSize + mPartitionPosition;
+    for(int i = 0; i < n; ++i)
+    {
+      outL[pos + i] = (low[pos + i] + busScale * busL[i]) * 0.5f;
+      outR[pos + i] = (low[pos + i] + busScale * busR[i]) * 0.5f;
+    }
+
+    mPartitionPosition += n;
+    pos += n;
+    if(mPartitionPosition == partitionSize)
+    {
+      processPartition();
+      mPartitionPosition = 0;
+      mNewestHalf ^= 1;
+    }
+  }
+}
+
+void BinauralMixer::processPartition()
+{
+  mNewestInputDFT = (mNewestInputDFT + 1) % mNumPartitions;
+  for(auto& dft : mBusDFT)
+    std::fill(dft.begin(), dft.end(), std::complex<float>());
+
+  for(auto& source : mSources)
+    addToBus(*source);
+
+  // one pair of inverse transforms for every source
+  mFFT->ifftPair(mBusDFT[0].data(), mBusDFT[1].data(), mBusOutput[0].data(), mBusOutput[1].data());
+}
+
+void BinauralMixer::addToBus(Source& source)
+{
+  const auto partitionSize = BinauralPanner::cPartitionSize;
+  for(int ear = 0; ear < getNumEarInputs(); ++ear)
+  {
+    const auto* ring = source.input[ear].data();
+    mFFT->fft(ring + (mNewestHalf ^ 1) * partitionSize, ring + mNewestHalf * partitionSize,
+              &source.inputDFTs[ear][mNewestInputDFT * mNumBins]);
+  }
+
+  // partition k of the filter applies to the frame k partitions old
+  auto filter = [this](const ComplexVector<float>& inputDFTs, const ComplexVector<float>& tf, std::complex<float>* out)
+  {
+    for(int k = 0; k < mNumPartitions; ++k)
+    {
+      const auto frame = (mNewestInputDFT - k + mNumPartitions) % mNumPartitions;
+      VectorOps::complexMultiplyAdd(&inputDFTs[frame * mNumBins], &tf[k * mNumBins], out, mNumBins);
+    }
+  };
+
+  for(int ear = 0; ear < 2; ++ear)
+  {
+    const auto& inputDFTs = source.inputDFTs[getNumEarInputs() == 2 ? ear : 0];
+    const auto& target = source.transferFunction[source.currentTargetFilterIndex][ear];
+    if(source.crossfadePending)
+    {
+      // as in HRIRFilter, over one partition; the crossfade doubles the level, so half of it is added
+      std::fill(mFilteredDFT[0].begin(), mFilteredDFT[0].end(), std::complex<float>());
+      std::fill(mFilteredDFT[1].begin(), mFilteredDFT[1].end(), std::complex<float>());
+      filter(inputDFTs, source.transferFunction[source.currentTargetFilterIndex ^ 1][ear], mFilteredDFT[0].data());
+      filter(inputDFTs, target, mFilteredDFT[1].data());
+      VectorOps::crossfade(mFilteredDFT[0].data(), mFilteredDFT[1].data(), mFilteredDFT[2].data(), mNumBins);
+      for(int i = 0; i < mNumBins; ++i)
+        mBusDFT[ear][i] += 0.5f * mFilteredDFT[2][i];
+    }
+    else
+      filter(inputDFTs, target, mBusDFT[ear].data());
+  }
+  source.crossfadePending = false;
+}
+
+void BinauralMixer::updatePosition(Source& source, bool inBackground)
+{
+  Point3DoublePolar<float> sourcePos;
+  sourcePos.radius = 1.;
+  sourcePos.azimuth = deg2rad(source.azimuth);
+  sourcePos.elevation = deg2rad(source.elevation);
+
+  auto p = sphericalToInteraural(sourcePos);
+
+  if(inBackground)
+    source.hrtfContainer.requestHRTF(rad2deg(p.azimuth), rad2deg(p.elevation));
+  else
+  {
+    source.hrtfContainer.updateHRTF(rad2deg(p.azimuth), rad2deg(p.elevation));
+    setFilters(source, source.hrtfContainer.hrtf());
+  }
+  source.prevAzimuth = source.azimuth;
+  source.prevElevation = source.elevation;
+}
+
+void BinauralMixer::setFilters(Source& source, const HRTFBuffer& hrtf)
+{
+  // several changes within one partition crossfade from what was last heard to the newest
+  if(!source.crossfadePending)
+    source.currentTargetFilterIndex ^= 1;
+  auto& target = source.transferFunction[source.currentTargetFilterIndex];
+  jassert(hrtf.leftEarTF.size() == target[0].size() && hrtf.rightEarTF.size() == target[1].size());
+  std::copy(hrtf.leftEarTF.begin(), hrtf.leftEarTF.end(), target[0].begin());
+  std::copy(hrtf.rightEarTF.begin(), hrtf.rightEarTF.end(), target[1].begin());
+  source.crossfadePending = true;
+
+  source.delays[0].setDelay(hrtf.leftEarDelay);
+  source.delays[1].setDelay(hrtf.rightEarDelay);
+}
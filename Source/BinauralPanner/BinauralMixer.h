@@ -0,0 +1,116 @@
+/*
+  ==============================================================================
+
+    BinauralMixer.h
+
+  ==============================================================================
+*/
+
+#ifndef BINAURALMIXER_H_INCLUDED
+#define BINAURALMIXER_H_INCLUDED
+
+#include "BinauralPanner.h"
+
+/** Renders any number of mono sources, each at its own position, to one binaural pair.
+    Does what a BinauralPanner per source would, from the same parts, but the sources only
+    meet in the frequency domain: each source's partitions are transformed and multiplied by
+    its HRTFs as in HRIRFilter, then added to one spectrum per ear, so a single pair of inverse
+    transforms serves them all. The low bands, which are not spatialised, are summed before
+    the crossover, so only the high-pass filter runs per source.
+    With minimum-phase sets each ear of a source has its own delay line ahead of the transforms,
+    which then take two forward transforms per source instead of one, see setDelaysInFilters().
+*/
+class BinauralMixer
+{
+public:
+  BinauralMixer();
+  ~BinauralMixer();
+
+  // Allocates, call while not processing. New sources start straight ahead.
+  void setNumSources(int numSources);
+  int getNumSources() const { return (int) mSources.size(); }
+
+  void prepareToPlay (double sampleRate, int estimatedSamplesPerBlock);
+  // buffer holds one source per channel, and at least two channels; the binaural mix replaces
+  // the first two. Takes blocks of any size up to the one given to prepareToPlay().
+  void processBlock(AudioBuffer<float> &buffer);
+
+  // Delay in samples added by processBlock(), for the host to compensate
+  int getLatencySamples() const { return BinauralPanner::cPartitionSize; }
+
+  void setPosition(int source, float azimuth, float elevation);
+  void setCrossoverFreq(float freq);
+
+  // Applies the interaural delays of minimum-phase sets as part of each source's filters
+  // instead of with a delay line per ear, which saves a forward transform per source and
+  // needs more partitions. Every move then rebuilds the source's filters from its IRs, still
+  // in the background but at a forward transform per partition and ear, see
+  // HRTFContainer::prepare(). Call while not processing.
+  void setDelaysInFilters(bool delaysInFilters);
+
+  // As for BinauralPanner. Call while not processing.
+  bool loadHRTFSet(const File& file, const HRTFDatabase::LoadOptions& options = BinauralPanner::getDefaultHRTFOptions());
+  void setHRTFLookupResolution(double azimuthStep, double elevationStep);
+
+private:
+  struct Source
+  {
+    explicit Source(const HRTFDatabase::LoadOptions& options) : hrtfContainer(options) {}
+
+    HRTFContainer hrtfContainer;
+    Crossover crossover;
+    FractionalDelay delays[2]; // [ear]
+    AudioSampleBuffer ears; // the block's high band through each ear's delay
+
+    float azimuth = 0.f, elevation = 0.f;
+    float prevAzimuth = -1.f, prevElevation = -1.f;
+
+    std::vector<float> input[2]; // [ear], rings of two partitions as in HRIRFilter
+    ComplexVector<float> inputDFTs[2]; // [ear], spectra of the last frames, [frame][bin]
+    ComplexVector<float> transferFunction[2][2]; // [filter][ear], each [partition][bin]
+    int currentTargetFilterIndex = 0;
+    bool crossfadePending = false;
+  };
+
+  void prepareFilters();
+  void prepareSource(Source& source);
+  void updatePosition(Source& source, bool inBackground);
+  void setFilters(Source& source, const HRTFBuffer& hrtf);
+  // Adds a source's newest frame, filtered, to the bus spectra
+  void addToBus(Source& source);
+  void processPartition();
+  int getNumEarInputs() const { return mEarDelays == EarDelays::DelayLines ? 2 : 1; }
+
+  std::vector<std::unique_ptr<Source>> mSources;
+
+  double mSampleRate;
+  int mBlockSize;
+  bool mEnable;
+  float mCrossoverFreq;
+  File mHRTFFile;
+  HRTFDatabase::LoadOptions mHRTFOptions;
+  double mLookupAzimuthStep, mLookupElevationStep;
+  bool mDelaysInFilters;
+
+  // How the set's interaural delays are applied, if it has any
+  enum class EarDelays { None, DelayLines, InFilters };
+  EarDelays mEarDelays;
+
+  // Shared partition clock, see HRIRFilter
+  std::unique_ptr<FFT> mFFT;
+  int mNumPartitions;
+  int mNumBins;
+  int mPartitionPosition;
+  int mNewestHalf;
+  int mNewestInputDFT;
+
+  ComplexVector<float> mFilteredDFT[3]; // current, target and crossfaded, for one source and ear
+  ComplexVector<float> mBusDFT[2]; // [ear]
+  std::vector<float> mBusOutput[2]; // [ear], second half is the output of the last partition
+
+  Crossover mLowFreqCrossover;
+  AudioSampleBuffer mLowFreqBuffer; // sum of the sources, then its low band
+  FractionalDelay mLowFreqDelay; // keeps the low band in step with the filters
+};
+
+#endif  // BINAURALMIXER_H_INCLUDED
@@ -17,17 +17,57 @@ BinauralPanner::BinauralPanner()
 , mElevation(0)
 , mPrevAzimuth(-1)
 , mPrevElevation(-1)
+, mGlideAzimuth(0)
+, mGlideElevation(0)
+, mForceUpdate(true)
+, mUpdateInterval(cDefaultUpdateInterval)
+, mUpdateThreshold(cDefaultUpdateThreshold)
+, mSamplesToNextUpdate(0)
 , mSampleRate(44100.)
 , mEnable(false)
+, mZeroLatency(false)
+, mHRTFContainer(getDefaultHRTFOptions())
 {
-  mHRTFContainer.loadHrir();
-  mHRTFContainer.updateHRIR(0, 0);
 }
 
 BinauralPanner::~BinauralPanner()
 {
 }
 
+HRTFDatabase::LoadOptions BinauralPanner::getDefaultHRTFOptions()
+{
+  HRTFDatabase::LoadOptions options;
+  options.minimumPhaseTaps = cMinimumPhaseTaps;
+  return options;
+}
+
+bool BinauralPanner::loadHRTFSet(const File& file, const HRTFDatabase::LoadOptions& options)
+{
+  if(!mHRTFContainer.loadHRTFSet(file, options))
+    return false;
+  
+  // the new set's IR length may need a different number of partitions
+  if(mEnable)
+    prepareFilters();
+  
+  // force the HRTF to be interpolated from the new set on the next tick
+  mForceUpdate = true;
+  return true;
+}
+
+void BinauralPanner::setHRTFLookupResolution(double azimuthStep, double elevationStep)
+{
+  mHRTFContainer.setLookupTableResolution(azimuthStep, elevationStep);
+  mForceUpdate = true;
+}
+
+void BinauralPanner::setZeroLatency(bool zeroLatency)
+{
+  mZeroLatency = zeroLatency;
+  if(mEnable)
+    prepareFilters();
+}
+
 void BinauralPanner::prepareToPlay (double sampleRate, int estimatedSamplesPerBlock)
 {
   mSampleRate = (float) sampleRate;
@@ -37,14 +77,28 @@ void BinauralPanner::prepareToPlay (double sampleRate, int estimatedSamplesPerBl
   mHighFreqBuffer.setSize(1, estimatedSamplesPerBlock);
   mScratchBuffer.setSize(2, estimatedSamplesPerBlock);
   
-  if(isPowerOfTwo(estimatedSamplesPerBlock))
-  {
-    hrirFilterL.prepare(estimatedSamplesPerBlock);
-    hrirFilterR.prepare(estimatedSamplesPerBlock);
-    mEnable = true;
-  }
-  else
-    mEnable = false;
+  mLowFreqDelay.prepare((float) cPartitionSize);
+  mLowFreqDelay.setDelay((float) cPartitionSize);
+  mLowFreqDelay.reset();
+  
+  prepareFilters();
+  mEnable = true;
+}
+
+void BinauralPanner::prepareFilters()
+{
+  // the HRIR filters work in partitions of their own, whatever the host's block size
+  hrirFilter.prepare(cPartitionSize, mHRTFContainer.getIRLength(),
+                     mZeroLatency ? HRIRFilter::Mode::ZeroLatency : HRIRFilter::Mode::Partitioned);
+  mHRTFContainer.prepare(hrirFilter.getFFTSize());
+  mDelayL.prepare(mHRTFContainer.getMaxDelay());
+  mDelayR.prepare(mHRTFContainer.getMaxDelay());
+  // start from the current position straight away, later moves are prepared in the background
+  updatePosition(mAzimuth, mElevation, false);
+  mForceUpdate = false;
+  mGlideAzimuth = mAzimuth;
+  mGlideElevation = mElevation;
+  mSamplesToNextUpdate = mUpdateInterval;
 }
 
 void BinauralPanner::processBlock(AudioBuffer<float> &buffer, int chanIdx)
@@ -52,36 +106,41 @@ void BinauralPanner::processBlock(AudioBuffer<float> &buffer, int chanIdx)
   if(!mEnable)
     return;
   
-  if(mAzimuth != mPrevAzimuth || mElevation != mPrevElevation)
-  {
-    Point3DoublePolar<float> sourcePos;
-    sourcePos.radius = 1.;
-    sourcePos.azimuth = deg2rad(mAzimuth);
-    sourcePos.elevation = deg2rad(mElevation);
-
-    auto p = sphericalToInteraural(sourcePos);
-
-    mHRTFContainer.updateHRIR(rad2deg(p.azimuth), rad2deg(p.elevation));
-    mPrevAzimuth = mAzimuth;
-    mPrevElevation = mElevation;
-  }
-  
   // get a pointer to the left or right channel data
   auto bufferLength = buffer.getNumSamples();
 
   // split the input signal into two bands, only freqs above crossover's f0 will be spatialized
   mCrossover.processBlock(buffer, mLowFreqBuffer, mHighFreqBuffer, chanIdx);
+  if(getLatencySamples() > 0)
+    mLowFreqDelay.process(mLowFreqBuffer.getWritePointer(0), bufferLength);
   
-  // copy high freq buffer into scratch
-  mScratchBuffer.copyFrom(0, 0, mHighFreqBuffer, 0, 0, bufferLength);
-  mScratchBuffer.copyFrom(1, 0, mHighFreqBuffer, 0, 0, bufferLength);
-
-  // actual hrir filtering
-  const auto& hrir = mHRTFContainer.hrir();
-  hrirFilterL.setImpulseResponse(hrir.leftEarIR);
-  hrirFilterR.setImpulseResponse(hrir.rightEarIR);
-  hrirFilterL.process(mScratchBuffer.getWritePointer(0), bufferLength);
-  hrirFilterR.process(mScratchBuffer.getWritePointer(1), bufferLength);
+  // actual hrir filtering, split where the filters follow the position. The worker can only
+  // keep up with one tick per block, blocks that hold more update in place.
+  const auto inBackground = bufferLength <= mUpdateInterval;
+  for(int pos = 0; pos < bufferLength;)
+  {
+    if(mSamplesToNextUpdate == 0)
+    {
+      updateFilters(pos, bufferLength, inBackground);
+      mSamplesToNextUpdate = mUpdateInterval;
+    }
+    const auto n = jmin(bufferLength - pos, mSamplesToNextUpdate);
+    float* left = mScratchBuffer.getWritePointer(0) + pos;
+    float* right = mScratchBuffer.getWritePointer(1) + pos;
+    hrirFilter.process(mHighFreqBuffer.getReadPointer(0) + pos, left, right, n);
+    
+    // minimum-phase sets leave the interaural time difference to the delay lines, which glide
+    // to a new delay over the rest of the interval
+    if(mHRTFContainer.getMaxDelay() > 0.f)
+    {
+      mDelayL.process(left, n);
+      mDelayR.process(right, n);
+    }
+    pos += n;
+    mSamplesToNextUpdate -= n;
+  }
+  mGlideAzimuth = mAzimuth;
+  mGlideElevation = mElevation;
   
   // copy to output
   float* outL = buffer.getWritePointer(0);
@@ -92,4 +151,62 @@ void BinauralPanner::processBlock(AudioBuffer<float> &buffer, int chanIdx)
     outL[i] = (mLowFreqBuffer.getReadPointer(0)[i] + mScratchBuffer.getReadPointer(0)[i]) * 0.5f;
     outR[i] = (mLowFreqBuffer.getReadPointer(0)[i] + mScratchBuffer.getReadPointer(1)[i]) * 0.5f;
   }
-}
\ No newline at end of file
+}
+
+void BinauralPanner::updateFilters(int offset, int blockLength, bool inBackground)
+{
+  // pick up the newest filter the worker has prepared, if any; in place updates make it stale
+  const auto* hrtf = mHRTFContainer.getNewHRTF();
+  if(hrtf != nullptr && inBackground)
+    setFilters(*hrtf);
+  
+  // where the position will have glided to by the next tick, the short way round
+  const auto t = jmin(1.f, (float) (offset + mUpdateInterval) / blockLength);
+  auto azimuthStep = mAzimuth - mGlideAzimuth;
+  if(azimuthStep > 180.f)
+    azimuthStep -= 360.f;
+  else if(azimuthStep < -180.f)
+    azimuthStep += 360.f;
+  auto azimuth = mGlideAzimuth + t * azimuthStep;
+  if(azimuth > 180.f)
+    azimuth -= 360.f;
+  else if(azimuth < -180.f)
+    azimuth += 360.f;
+  const auto elevation = mGlideElevation + t * (mElevation - mGlideElevation);
+  
+  // the angle between the filters' position and the new one
+  const auto cosAngle = std::sin(deg2rad(elevation)) * std::sin(deg2rad(mPrevElevation))
+    + std::cos(deg2rad(elevation)) * std::cos(deg2rad(mPrevElevation)) * std::cos(deg2rad(azimuth - mPrevAzimuth));
+  if(!mForceUpdate && rad2deg(std::acos(jlimit(-1.f, 1.f, cosAngle))) < mUpdateThreshold)
+    return;
+  
+  mForceUpdate = false;
+  updatePosition(azimuth, elevation, inBackground);
+}
+
+void BinauralPanner::updatePosition(float azimuth, float elevation, bool inBackground)
+{
+  Point3DoublePolar<float> sourcePos;
+  sourcePos.radius = 1.;
+  sourcePos.azimuth = deg2rad(azimuth);
+  sourcePos.elevation = deg2rad(elevation);
+
+  auto p = sphericalToInteraural(sourcePos);
+
+  if(inBackground)
+    mHRTFContainer.requestHRTF(rad2deg(p.azimuth), rad2deg(p.elevation));
+  else
+  {
+    mHRTFContainer.updateHRTF(rad2deg(p.azimuth), rad2deg(p.elevation));
+    setFilters(mHRTFContainer.hrtf());
+  }
+  mPrevAzimuth = azimuth;
+  mPrevElevation = elevation;
+}
+
+void BinauralPanner::setFilters(const HRTFBuffer& hrtf)
+{
+  hrirFilter.setTransferFunction(hrtf);
+  mDelayL.setDelay(hrtf.leftEarDelay);
+  mDelayR.setDelay(hrtf.rightEarDelay);
+}
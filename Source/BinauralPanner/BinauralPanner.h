@@ -16,31 +16,80 @@
 #include "../JuceLibraryCode/JuceHeader.h"
 #include "HRTFContainer.h"
 #include "HRIRFilter.h"
+#include "FractionalDelay.h"
 #include "Crossover.h"
 
 class BinauralPanner
 {
 public:
+  // HRIRs are rendered as a minimum-phase filter of this length plus a fractional delay per ear
+  static constexpr int cMinimumPhaseTaps = 96;
+  // Partition size of the HRIR filters, which is also the panner's latency unless it is set to
+  // zero latency. Holds a whole minimum-phase HRIR, so a steady source costs one multiply per bin and ear.
+  static constexpr int cPartitionSize = 128;
+  // Defaults of setUpdateInterval() and setUpdateThreshold()
+  static constexpr int cDefaultUpdateInterval = 256;
+  static constexpr float cDefaultUpdateThreshold = 1.f;
+  static HRTFDatabase::LoadOptions getDefaultHRTFOptions();
+  
   BinauralPanner();
   ~BinauralPanner();
   
   void prepareToPlay (double sampleRate, int estimatedSamplesPerBlock);
+  // Takes blocks of any size up to the one given to prepareToPlay()
   void processBlock(AudioBuffer<float> &buffer, int chanIdx = 0);
   
+  // Delay in samples added by processBlock(), for the host to compensate
+  int getLatencySamples() const { return mZeroLatency ? 0 : cPartitionSize; }
+  
+  // Applies the start of the HRIRs directly instead of a partition late, see HRIRFilter::Mode.
+  // Costs more CPU for long HRIRs. Call while not processing, and before prepareToPlay() for
+  // the host to pick up the new latency.
+  void setZeroLatency(bool zeroLatency);
+  
   void setAzimuth(float azimuth) { mAzimuth = jlimit<float>(-180, 180., azimuth); }
   void setElevation(float elevation) { mElevation = jlimit<float>(-90., 90., elevation); }
   void setCrossoverFreq(float freq) { mCrossover.setFrequency(freq); }
   
+  // The filters follow the position every interval samples, whatever the host's block size:
+  // blocks are split there, and the position glides across each block from where the last
+  // one left it. The filters stay put until the position is threshold degrees away from theirs.
+  void setUpdateInterval(int samples) { mUpdateInterval = jmax(1, samples); }
+  void setUpdateThreshold(float degrees) { mUpdateThreshold = degrees; }
+  
+  // Switches HRTF set, see HRTFContainer::loadHRTFSet(). Call while not processing.
+  bool loadHRTFSet(const File& file, const HRTFDatabase::LoadOptions& options = getDefaultHRTFOptions());
+  
+  // Trades memory for cheaper position updates, see HRTFContainer::setLookupTableResolution().
+  // Call while not processing.
+  void setHRTFLookupResolution(double azimuthStep, double elevationStep);
+  
 private:
+  void prepareFilters();
+  // Moves the filters on at a control-rate tick offset samples into a block of blockLength
+  void updateFilters(int offset, int blockLength, bool inBackground);
+  // Interpolates the filter for a position, on the HRTF worker if inBackground
+  void updatePosition(float azimuth, float elevation, bool inBackground);
+  void setFilters(const HRTFBuffer& hrtf);
+  
   float mAzimuth, mElevation;
-  float mPrevAzimuth, mPrevElevation;
+  float mPrevAzimuth, mPrevElevation; // the filters' position
+  float mGlideAzimuth, mGlideElevation; // where the last block left the position
+  bool mForceUpdate;
+  
+  int mUpdateInterval;
+  float mUpdateThreshold;
+  int mSamplesToNextUpdate;
     
   float mSampleRate;
   
   bool mEnable;
+  bool mZeroLatency;
   
-  HRIRFilter hrirFilterL;
-  HRIRFilter hrirFilterR;
+  HRIRFilter hrirFilter;
+  FractionalDelay mDelayL;
+  FractionalDelay mDelayR;
+  FractionalDelay mLowFreqDelay; // keeps the unfiltered band in step with the HRIR filters
   HRTFContainer mHRTFContainer;
   
   AudioSampleBuffer mLowFreqBuffer;
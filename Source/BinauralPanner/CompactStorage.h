@@ -0,0 +1,31 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+/** 16-bit storage of IRs, used by HRTFDatabase::LoadOptions::compactStorage and
+	ConvolutionReverb::setCompactIRStorage(), and measured by tools/StorageAccuracy.cpp.
+	Each IR, or reverb channel, gets its own scale, which maps its peak to 32767.
+*/
+namespace CompactStorage
+{
+	// Quantises n samples of in into out; returns the scale that expands them back
+	inline float quantise(const float* in, int16_t* out, int n)
+	{
+		auto peak = 0.f;
+		for (auto i = 0; i < n; ++i)
+			peak = std::max(peak, std::abs(in[i]));
+		const auto scale = peak > 0.f ? peak / 32767.f : 1.f;
+
+		for (auto i = 0; i < n; ++i)
+			out[i] = static_cast<int16_t>(std::lround(in[i] / scale));
+		return scale;
+	}
+
+	// out[i] = scale * in[i]
+	inline void expand(const int16_t* in, float scale, float* out, int n)
+	{
+		for (auto i = 0; i < n; ++i)
+			out[i] = scale * in[i];
+	}
+}
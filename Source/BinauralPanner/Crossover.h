@@ -105,6 +105,20 @@ public:
     }
   }
   
+  // One band at a time, e.g. to split the sum of several inputs whose low bands are mixed anyway
+  void processLowBand(const float* input, float* lfOutput, int numSamples)
+  {
+    for(int i=0;i<numSamples;i++)
+      lfOutput[i] = mLPF.doBiQuad(input[i]);
+  }
+  
+  void processHighBand(const float* input, float* hfOutput, int numSamples)
+  {
+    // inverted, as in processBlock()
+    for(int i=0;i<numSamples;i++)
+      hfOutput[i] = -mHPF.doBiQuad(input[i]);
+  }
+  
   void setFrequency(float freq) { freq = jlimit<float>(10, 20000., freq); calculateFilterBankCoeffs(freq); }
   
 private:
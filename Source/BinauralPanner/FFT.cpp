@@ -0,0 +1,38 @@
+#include "FFT.h"
+#include "FloatFFT.h"
+#include "OouraFFT.h"
+
+#ifndef FFT_USE_OOURA
+ #define FFT_USE_OOURA 0
+#endif
+
+
+std::unique_ptr<FFT> FFT::create(size_t nfft, Backend backend)
+{
+	if (backend == Backend::Default)
+		backend = FFT_USE_OOURA ? Backend::Ooura : Backend::Float;
+
+	std::unique_ptr<FFT> fft;
+	if (backend == Backend::Ooura)
+		fft.reset(new OouraFFT());
+	else
+		fft.reset(new FloatFFT());
+	fft->init(nfft);
+	return fft;
+}
+
+const char* FFT::getName(Backend backend)
+{
+	switch (backend)
+	{
+	case Backend::Ooura: return "Ooura";
+	case Backend::Float: return "Float";
+	default: return FFT_USE_OOURA ? "Ooura" : "Float";
+	}
+}
+
+void FFT::ifftPair(const std::complex<float>* left, const std::complex<float>* right, float* leftOut, float* rightOut)
+{
+	ifft(left, leftOut);
+	ifft(right, rightOut);
+}
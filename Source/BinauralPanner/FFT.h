@@ -0,0 +1,70 @@
+#pragma once
+#include <complex>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+
+/** Real-input FFT of one size, implemented by one of several backends.
+	Spectra have nfft / 2 + 1 bins in the convention of OouraFFT, the reference backend:
+	unnormalised, with imaginary parts of the opposite sign to the usual DFT, i.e.
+	X[k] = sum x[n] exp(+2 pi i n k / nfft). ifft(fft(x)) is x scaled by nfft / 2.
+	All backends agree to within rounding, so spectra from different backends can be mixed.
+	The default backend is FloatFFT, or OouraFFT when built with FFT_USE_OOURA=1;
+	create() can also ask for either at run time. Instances only own their work buffers,
+	the tables for each size are shared, see getPlan().
+*/
+class FFT
+{
+public:
+	enum class Backend
+	{
+		Default,
+		Ooura, // double precision reference, see OouraFFT.h
+		Float // native single precision, vectorised where SSE2 is available, see FloatFFT.h
+	};
+
+	static std::unique_ptr<FFT> create(size_t nfft, Backend backend = Backend::Default);
+	static const char* getName(Backend backend);
+
+	virtual ~FFT() {}
+
+	// prepare for fft/ifft
+	// nfft - size of the future transforms, a power of 2
+	virtual void init(size_t nfft) = 0;
+
+	// in must have length nfft
+	// out must have length nfft/2 + 1
+	virtual void fft(const float* in, std::complex<float>* out) = 0;
+
+	// Same for an input in two halves of nfft/2 samples, which need not be adjacent,
+	// e.g. the two halves of an overlap-save frame kept as a ring
+	virtual void fft(const float* firstHalf, const float* secondHalf, std::complex<float>* out) = 0;
+
+	// out must have length nfft
+	// in must have length nfft/2 + 1
+	virtual void ifft(const std::complex<float>* in, float* out) = 0;
+
+	// Inverse transforms of two spectra at once, scaled like ifft(). Backends that can
+	// pack both into one complex transform override this; by default it calls ifft() twice.
+	virtual void ifftPair(const std::complex<float>* left, const std::complex<float>* right, float* leftOut, float* rightOut);
+
+protected:
+	// Process-wide cache of a backend's immutable tables, keyed by size: every instance of one
+	// size shares one Plan, built by the first and freed when the last holder lets go.
+	// Safe to call from any thread.
+	template <typename Plan>
+	static std::shared_ptr<const Plan> getPlan(size_t nfft)
+	{
+		static std::mutex lock;
+		static std::map<size_t, std::weak_ptr<const Plan>> plans;
+
+		const std::lock_guard<std::mutex> guard(lock);
+		auto& cached = plans[nfft];
+		if (auto plan = cached.lock())
+			return plan;
+		auto plan = std::make_shared<const Plan>(nfft);
+		cached = plan;
+		return plan;
+	}
+};
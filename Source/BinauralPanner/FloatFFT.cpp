@@ -0,0 +1,367 @@
+#include <cassert>
+#include <cmath>
+#include "FloatFFT.h"
+#include "Util.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+ #define FLOATFFT_SSE 1
+ #include <emmintrin.h>
+#else
+ #define FLOATFFT_SSE 0
+#endif
+
+
+FloatFFT::Plan::Plan(size_t nfft)
+{
+	const auto size = static_cast<int>(nfft / 2);
+	for (auto n = size; n >= 4; n /= 4)
+	{
+		const auto m = n / 4;
+		for (auto multiple = 1; multiple <= 3; ++multiple)
+		{
+			for (auto p = 0; p < m; ++p)
+			{
+				const auto angle = -2. * 3.14159265358979323846 * multiple * p / n;
+				twiddleRe.push_back(static_cast<float>(std::cos(angle)));
+				twiddleIm.push_back(static_cast<float>(std::sin(angle)));
+			}
+		}
+	}
+
+	splitRe.resize(size + 1);
+	splitIm.resize(size + 1);
+	for (auto k = 0; k <= size; ++k)
+	{
+		const auto angle = -2. * 3.14159265358979323846 * k / nfft;
+		splitRe[k] = static_cast<float>(std::cos(angle));
+		splitIm[k] = static_cast<float>(std::sin(angle));
+	}
+}
+
+void FloatFFT::init(size_t nfft)
+{
+	assert(isPowerOf2(nfft) && nfft >= 2);
+	nfft_ = static_cast<int>(nfft);
+	size_ = nfft_ / 2;
+	plan_ = getPlan<Plan>(nfft);
+
+	re_.assign(size_, 0.f);
+	im_.assign(size_, 0.f);
+	workRe_.assign(size_, 0.f);
+	workIm_.assign(size_, 0.f);
+}
+
+void FloatFFT::transform(float*& resultRe, float*& resultIm)
+{
+	auto* xr = re_.data();
+	auto* xi = im_.data();
+	auto* yr = workRe_.data();
+	auto* yi = workIm_.data();
+	const auto* twRe = plan_->twiddleRe.data();
+	const auto* twIm = plan_->twiddleIm.data();
+
+	// Stockham: each stage reads x and writes y in order, so no bit reversal is needed.
+	// Sub-transforms of size n are interleaved with stride s; n * s == size_ throughout.
+	auto s = 1;
+	auto n = size_;
+	for (; n >= 4; n /= 4, s *= 4)
+	{
+		const auto m = n / 4;
+		const float* w1r = twRe;
+		const float* w1i = twIm;
+		const float* w2r = twRe + m;
+		const float* w2i = twIm + m;
+		const float* w3r = twRe + 2 * m;
+		const float* w3i = twIm + 2 * m;
+		twRe += 3 * m;
+		twIm += 3 * m;
+
+		auto p = 0;
+	   #if FLOATFFT_SSE
+		if (s == 1)
+		{
+			// First stage: four consecutive butterflies per vector, whose outputs are
+			// interleaved by a transpose
+			for (; p + 4 <= m; p += 4)
+			{
+				const auto ar = _mm_loadu_ps(xr + p), ai = _mm_loadu_ps(xi + p);
+				const auto br = _mm_loadu_ps(xr + p + m), bi = _mm_loadu_ps(xi + p + m);
+				const auto cr = _mm_loadu_ps(xr + p + 2 * m), ci = _mm_loadu_ps(xi + p + 2 * m);
+				const auto dr = _mm_loadu_ps(xr + p + 3 * m), di = _mm_loadu_ps(xi + p + 3 * m);
+
+				const auto apcR = _mm_add_ps(ar, cr), apcI = _mm_add_ps(ai, ci);
+				const auto amcR = _mm_sub_ps(ar, cr), amcI = _mm_sub_ps(ai, ci);
+				const auto bpdR = _mm_add_ps(br, dr), bpdI = _mm_add_ps(bi, di);
+				// -i (b - d)
+				const auto jbmdR = _mm_sub_ps(bi, di), jbmdI = _mm_sub_ps(dr, br);
+
+				auto y0r = _mm_add_ps(apcR, bpdR), y0i = _mm_add_ps(apcI, bpdI);
+				const auto t1r = _mm_add_ps(amcR, jbmdR), t1i = _mm_add_ps(amcI, jbmdI);
+				const auto t2r = _mm_sub_ps(apcR, bpdR), t2i = _mm_sub_ps(apcI, bpdI);
+				const auto t3r = _mm_sub_ps(amcR, jbmdR), t3i = _mm_sub_ps(amcI, jbmdI);
+
+				const auto v1r = _mm_loadu_ps(w1r + p), v1i = _mm_loadu_ps(w1i + p);
+				const auto v2r = _mm_loadu_ps(w2r + p), v2i = _mm_loadu_ps(w2i + p);
+				const auto v3r = _mm_loadu_ps(w3r + p), v3i = _mm_loadu_ps(w3i + p);
+				auto y1r = _mm_sub_ps(_mm_mul_ps(t1r, v1r), _mm_mul_ps(t1i, v1i));
+				auto y1i = _mm_add_ps(_mm_mul_ps(t1r, v1i), _mm_mul_ps(t1i, v1r));
+				auto y2r = _mm_sub_ps(_mm_mul_ps(t2r, v2r), _mm_mul_ps(t2i, v2i));
+				auto y2i = _mm_add_ps(_mm_mul_ps(t2r, v2i), _mm_mul_ps(t2i, v2r));
+				auto y3r = _mm_sub_ps(_mm_mul_ps(t3r, v3r), _mm_mul_ps(t3i, v3i));
+				auto y3i = _mm_add_ps(_mm_mul_ps(t3r, v3i), _mm_mul_ps(t3i, v3r));
+
+				_MM_TRANSPOSE4_PS(y0r, y1r, y2r, y3r);
+				_MM_TRANSPOSE4_PS(y0i, y1i, y2i, y3i);
+				_mm_storeu_ps(yr + 4 * p, y0r);
+				_mm_storeu_ps(yr + 4 * p + 4, y1r);
+				_mm_storeu_ps(yr + 4 * p + 8, y2r);
+				_mm_storeu_ps(yr + 4 * p + 12, y3r);
+				_mm_storeu_ps(yi + 4 * p, y0i);
+				_mm_storeu_ps(yi + 4 * p + 4, y1i);
+				_mm_storeu_ps(yi + 4 * p + 8, y2i);
+				_mm_storeu_ps(yi + 4 * p + 12, y3i);
+			}
+		}
+	   #endif
+
+		for (; p < m; ++p)
+		{
+			auto q = 0;
+		   #if FLOATFFT_SSE
+			// Later stages: four interleaved sub-transforms per vector, sharing the twiddles
+			const auto v1r = _mm_set1_ps(w1r[p]), v1i = _mm_set1_ps(w1i[p]);
+			const auto v2r = _mm_set1_ps(w2r[p]), v2i = _mm_set1_ps(w2i[p]);
+			const auto v3r = _mm_set1_ps(w3r[p]), v3i = _mm_set1_ps(w3i[p]);
+			for (; q + 4 <= s; q += 4)
+			{
+				const auto ar = _mm_loadu_ps(xr + q + s * p), ai = _mm_loadu_ps(xi + q + s * p);
+				const auto br = _mm_loadu_ps(xr + q + s * (p + m)), bi = _mm_loadu_ps(xi + q + s * (p + m));
+				const auto cr = _mm_loadu_ps(xr + q + s * (p + 2 * m)), ci = _mm_loadu_ps(xi + q + s * (p + 2 * m));
+				const auto dr = _mm_loadu_ps(xr + q + s * (p + 3 * m)), di = _mm_loadu_ps(xi + q + s * (p + 3 * m));
+
+				const auto apcR = _mm_add_ps(ar, cr), apcI = _mm_add_ps(ai, ci);
+				const auto amcR = _mm_sub_ps(ar, cr), amcI = _mm_sub_ps(ai, ci);
+				const auto bpdR = _mm_add_ps(br, dr), bpdI = _mm_add_ps(bi, di);
+				const auto jbmdR = _mm_sub_ps(bi, di), jbmdI = _mm_sub_ps(dr, br);
+
+				const auto t1r = _mm_add_ps(amcR, jbmdR), t1i = _mm_add_ps(amcI, jbmdI);
+				const auto t2r = _mm_sub_ps(apcR, bpdR), t2i = _mm_sub_ps(apcI, bpdI);
+				const auto t3r = _mm_sub_ps(amcR, jbmdR), t3i = _mm_sub_ps(amcI, jbmdI);
+
+				_mm_storeu_ps(yr + q + s * 4 * p, _mm_add_ps(apcR, bpdR));
+				_mm_storeu_ps(yi + q + s * 4 * p, _mm_add_ps(apcI, bpdI));
+				_mm_storeu_ps(yr + q + s * (4 * p + 1), _mm_sub_ps(_mm_mul_ps(t1r, v1r), _mm_mul_ps(t1i, v1i)));
+				_mm_storeu_ps(yi + q + s * (4 * p + 1), _mm_add_ps(_mm_mul_ps(t1r, v1i), _mm_mul_ps(t1i, v1r)));
+				_mm_storeu_ps(yr + q + s * (4 * p + 2), _mm_sub_ps(_mm_mul_ps(t2r, v2r), _mm_mul_ps(t2i, v2i)));
+				_mm_storeu_ps(yi + q + s * (4 * p + 2), _mm_add_ps(_mm_mul_ps(t2r, v2i), _mm_mul_ps(t2i, v2r)));
+				_mm_storeu_ps(yr + q + s * (4 * p + 3), _mm_sub_ps(_mm_mul_ps(t3r, v3r), _mm_mul_ps(t3i, v3i)));
+				_mm_storeu_ps(yi + q + s * (4 * p + 3), _mm_add_ps(_mm_mul_ps(t3r, v3i), _mm_mul_ps(t3i, v3r)));
+			}
+		   #endif
+			for (; q < s; ++q)
+			{
+				const auto ar = xr[q + s * p], ai = xi[q + s * p];
+				const auto br = xr[q + s * (p + m)], bi = xi[q + s * (p + m)];
+				const auto cr = xr[q + s * (p + 2 * m)], ci = xi[q + s * (p + 2 * m)];
+				const auto dr = xr[q + s * (p + 3 * m)], di = xi[q + s * (p + 3 * m)];
+
+				const auto apcR = ar + cr, apcI = ai + ci;
+				const auto amcR = ar - cr, amcI = ai - ci;
+				const auto bpdR = br + dr, bpdI = bi + di;
+				const auto jbmdR = bi - di, jbmdI = dr - br;
+
+				const auto t1r = amcR + jbmdR, t1i = amcI + jbmdI;
+				const auto t2r = apcR - bpdR, t2i = apcI - bpdI;
+				const auto t3r = amcR - jbmdR, t3i = amcI - jbmdI;
+
+				yr[q + s * 4 * p] = apcR + bpdR;
+				yi[q + s * 4 * p] = apcI + bpdI;
+				yr[q + s * (4 * p + 1)] = t1r * w1r[p] - t1i * w1i[p];
+				yi[q + s * (4 * p + 1)] = t1r * w1i[p] + t1i * w1r[p];
+				yr[q + s * (4 * p + 2)] = t2r * w2r[p] - t2i * w2i[p];
+				yi[q + s * (4 * p + 2)] = t2r * w2i[p] + t2i * w2r[p];
+				yr[q + s * (4 * p + 3)] = t3r * w3r[p] - t3i * w3i[p];
+				yi[q + s * (4 * p + 3)] = t3r * w3i[p] + t3i * w3r[p];
+			}
+		}
+
+		std::swap(xr, yr);
+		std::swap(xi, yi);
+	}
+
+	if (n == 2)
+	{
+		// Final radix-2 stage, its twiddle is 1
+		auto q = 0;
+	   #if FLOATFFT_SSE
+		for (; q + 4 <= s; q += 4)
+		{
+			const auto ar = _mm_loadu_ps(xr + q), ai = _mm_loadu_ps(xi + q);
+			const auto br = _mm_loadu_ps(xr + q + s), bi = _mm_loadu_ps(xi + q + s);
+			_mm_storeu_ps(yr + q, _mm_add_ps(ar, br));
+			_mm_storeu_ps(yi + q, _mm_add_ps(ai, bi));
+			_mm_storeu_ps(yr + q + s, _mm_sub_ps(ar, br));
+			_mm_storeu_ps(yi + q + s, _mm_sub_ps(ai, bi));
+		}
+	   #endif
+		for (; q < s; ++q)
+		{
+			const auto ar = xr[q], ai = xi[q];
+			const auto br = xr[q + s], bi = xi[q + s];
+			yr[q] = ar + br;
+			yi[q] = ai + bi;
+			yr[q + s] = ar - br;
+			yi[q + s] = ai - bi;
+		}
+		std::swap(xr, yr);
+		std::swap(xi, yi);
+	}
+
+	resultRe = xr;
+	resultIm = xi;
+}
+
+void FloatFFT::deinterleave(const float* in, float* re, float* im, int numPairs)
+{
+	auto n = 0;
+   #if FLOATFFT_SSE
+	for (; n + 4 <= numPairs; n += 4)
+	{
+		const auto a = _mm_loadu_ps(in + 2 * n), b = _mm_loadu_ps(in + 2 * n + 4);
+		_mm_storeu_ps(re + n, _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+		_mm_storeu_ps(im + n, _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+	}
+   #endif
+	for (; n < numPairs; ++n)
+	{
+		re[n] = in[2 * n];
+		im[n] = in[2 * n + 1];
+	}
+}
+
+void FloatFFT::fft(const float* in, std::complex<float>* out)
+{
+	fft(in, in + size_, out);
+}
+
+void FloatFFT::fft(const float* firstHalf, const float* secondHalf, std::complex<float>* out)
+{
+	// z[n] = x[2n] + i x[2n + 1]
+	if (size_ == 1)
+	{
+		re_[0] = firstHalf[0];
+		im_[0] = secondHalf[0];
+	}
+	else
+	{
+		deinterleave(firstHalf, re_.data(), im_.data(), size_ / 2);
+		deinterleave(secondHalf, re_.data() + size_ / 2, im_.data() + size_ / 2, size_ / 2);
+	}
+
+	float* zr;
+	float* zi;
+	transform(zr, zi);
+
+	// X[k] = E[k] + w^k O[k], where E = (Z[k] + conj Z[-k]) / 2 and O = (Z[k] - conj Z[-k]) / 2i
+	// are the spectra of the even and odd samples. The output takes Ooura's sign for the
+	// imaginary part, so it is conj X[k].
+	out[0] = std::complex<float>(zr[0] + zi[0], 0.f);
+	out[size_] = std::complex<float>(zr[0] - zi[0], 0.f);
+	const auto* splitRe = plan_->splitRe.data();
+	const auto* splitIm = plan_->splitIm.data();
+	auto k = 1;
+   #if FLOATFFT_SSE
+	// Z[-k] is read backwards, four bins at a time
+	const auto half = _mm_set1_ps(0.5f);
+	auto* outf = reinterpret_cast<float*>(out);
+	for (; k + 4 <= size_; k += 4)
+	{
+		const auto j = size_ - k - 3;
+		const auto zkr = _mm_loadu_ps(zr + k), zki = _mm_loadu_ps(zi + k);
+		auto zjr = _mm_loadu_ps(zr + j), zji = _mm_loadu_ps(zi + j);
+		zjr = _mm_shuffle_ps(zjr, zjr, _MM_SHUFFLE(0, 1, 2, 3));
+		zji = _mm_shuffle_ps(zji, zji, _MM_SHUFFLE(0, 1, 2, 3));
+
+		const auto er = _mm_mul_ps(half, _mm_add_ps(zkr, zjr)), ei = _mm_mul_ps(half, _mm_sub_ps(zki, zji));
+		const auto or_ = _mm_mul_ps(half, _mm_add_ps(zki, zji)), oi = _mm_mul_ps(half, _mm_sub_ps(zjr, zkr));
+		const auto wr = _mm_loadu_ps(splitRe + k), wi = _mm_loadu_ps(splitIm + k);
+		const auto xr = _mm_add_ps(er, _mm_sub_ps(_mm_mul_ps(wr, or_), _mm_mul_ps(wi, oi)));
+		const auto xi = _mm_sub_ps(_mm_setzero_ps(), _mm_add_ps(ei, _mm_add_ps(_mm_mul_ps(wr, oi), _mm_mul_ps(wi, or_))));
+		_mm_storeu_ps(outf + 2 * k, _mm_unpacklo_ps(xr, xi));
+		_mm_storeu_ps(outf + 2 * k + 4, _mm_unpackhi_ps(xr, xi));
+	}
+   #endif
+	for (; k < size_; ++k)
+	{
+		const auto j = size_ - k;
+		const auto er = 0.5f * (zr[k] + zr[j]), ei = 0.5f * (zi[k] - zi[j]);
+		const auto or_ = 0.5f * (zi[k] + zi[j]), oi = 0.5f * (zr[j] - zr[k]);
+		const auto wr = splitRe[k], wi = splitIm[k];
+		out[k] = std::complex<float>(er + wr * or_ - wi * oi, -(ei + wr * oi + wi * or_));
+	}
+}
+
+void FloatFFT::ifft(const std::complex<float>* in, float* out)
+{
+	// Undo the split above: E[k] = (X[k] + conj X[N/2 - k]) / 2, O[k] = w^-k (X[k] - conj X[N/2 - k]) / 2,
+	// Z = E + iO, with X[k] = conj in[k]. The inverse transform is done as a forward one
+	// on conj Z, so conj Z is what gets stored.
+	const auto* splitRe = plan_->splitRe.data();
+	const auto* splitIm = plan_->splitIm.data();
+	auto k = 0;
+   #if FLOATFFT_SSE
+	const auto half = _mm_set1_ps(0.5f);
+	const auto* inf = reinterpret_cast<const float*>(in);
+	for (; k + 4 <= size_; k += 4)
+	{
+		// in[k .. k + 3] and, backwards, in[N/2 - k .. N/2 - k - 3]
+		const auto a = _mm_loadu_ps(inf + 2 * k), b = _mm_loadu_ps(inf + 2 * k + 4);
+		const auto xr = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+		const auto xi = _mm_sub_ps(_mm_setzero_ps(), _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+		const auto j = size_ - k - 3;
+		const auto c = _mm_loadu_ps(inf + 2 * j), d = _mm_loadu_ps(inf + 2 * j + 4);
+		const auto cr = _mm_shuffle_ps(d, c, _MM_SHUFFLE(0, 2, 0, 2));
+		const auto ci = _mm_shuffle_ps(d, c, _MM_SHUFFLE(1, 3, 1, 3));
+
+		const auto er = _mm_mul_ps(half, _mm_add_ps(xr, cr)), ei = _mm_mul_ps(half, _mm_add_ps(xi, ci));
+		const auto dr = _mm_mul_ps(half, _mm_sub_ps(xr, cr)), di = _mm_mul_ps(half, _mm_sub_ps(xi, ci));
+		const auto wr = _mm_loadu_ps(splitRe + k), wi = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(splitIm + k));
+		const auto or_ = _mm_sub_ps(_mm_mul_ps(dr, wr), _mm_mul_ps(di, wi));
+		const auto oi = _mm_add_ps(_mm_mul_ps(dr, wi), _mm_mul_ps(di, wr));
+		_mm_storeu_ps(&re_[k], _mm_sub_ps(er, oi));
+		_mm_storeu_ps(&im_[k], _mm_sub_ps(_mm_setzero_ps(), _mm_add_ps(ei, or_)));
+	}
+   #endif
+	for (; k < size_; ++k)
+	{
+		const auto j = size_ - k;
+		const auto xr = in[k].real(), xi = -in[k].imag();
+		const auto cr = in[j].real(), ci = in[j].imag(); // conj X[N/2 - k]
+		const auto er = 0.5f * (xr + cr), ei = 0.5f * (xi + ci);
+		const auto dr = 0.5f * (xr - cr), di = 0.5f * (xi - ci);
+		// w^-k = conj w^k
+		const auto wr = splitRe[k], wi = -splitIm[k];
+		const auto or_ = dr * wr - di * wi, oi = dr * wi + di * wr;
+		re_[k] = er - oi;
+		im_[k] = -(ei + or_);
+	}
+
+	float* zr;
+	float* zi;
+	transform(zr, zi);
+
+	auto n = 0;
+   #if FLOATFFT_SSE
+	for (; n + 4 <= size_; n += 4)
+	{
+		const auto r = _mm_loadu_ps(zr + n), i = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(zi + n));
+		_mm_storeu_ps(out + 2 * n, _mm_unpacklo_ps(r, i));
+		_mm_storeu_ps(out + 2 * n + 4, _mm_unpackhi_ps(r, i));
+	}
+   #endif
+	for (; n < size_; ++n)
+	{
+		out[2 * n] = zr[n];
+		out[2 * n + 1] = -zi[n];
+	}
+}
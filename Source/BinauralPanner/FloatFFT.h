@@ -0,0 +1,43 @@
+#pragma once
+#include <vector>
+#include "FFT.h"
+
+/** Single precision FFT backend.
+	A real transform of nfft points is computed as a complex transform of nfft / 2 points
+	on the even and odd samples, plus a pass that separates their spectra. The complex
+	transform is a radix-4 Stockham autosort FFT (with one radix-2 stage for odd powers of 2)
+	on split real and imaginary arrays, so every stage runs four butterflies per SSE2
+	instruction without any bit reversal.
+*/
+class FloatFFT : public FFT
+{
+public:
+	void init(size_t nfft) override;
+	void fft(const float* in, std::complex<float>* out) override;
+	void fft(const float* firstHalf, const float* secondHalf, std::complex<float>* out) override;
+	void ifft(const std::complex<float>* in, float* out) override;
+
+private:
+	// Forward complex transform of re_/im_; returns the arrays holding the result
+	void transform(float*& resultRe, float*& resultIm);
+	// Even samples of in to re, odd ones to im
+	static void deinterleave(const float* in, float* re, float* im, int numPairs);
+
+	// Twiddles for one size, shared by every FloatFFT of that size
+	struct Plan
+	{
+		explicit Plan(size_t nfft);
+
+		// Per radix-4 stage, with m = n / 4 butterflies: w^p, w^2p and w^3p for p < m,
+		// stored as [stage][w1, w2, w3][p]
+		std::vector<float> twiddleRe, twiddleIm;
+		// exp(-2 pi i k / nfft) for the pass between the real and the complex transform
+		std::vector<float> splitRe, splitIm;
+	};
+
+	int nfft_ = 0;
+	int size_ = 0; // of the complex transform, nfft / 2
+	std::shared_ptr<const Plan> plan_;
+	std::vector<float> re_, im_;
+	std::vector<float> workRe_, workIm_;
+};
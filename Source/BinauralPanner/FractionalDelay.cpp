@@ -0,0 +1,75 @@
+#include <algorithm>
+#include <cmath>
+#include "FractionalDelay.h"
+#include "Util.h"
+
+
+void FractionalDelay::prepare(float maxDelay)
+{
+	maxDelay_ = std::max(1.f, maxDelay);
+	// Room for the delay, the interpolator's extra taps and the write position
+	const auto size = nextPowerOf2(static_cast<int>(std::ceil(maxDelay_)) + 4);
+	buffer_.assign(size, 0.f);
+	mask_ = size - 1;
+	writeIndex_ = 0;
+	currentDelay_ = targetDelay_ = clamp(targetDelay_, 1.f, maxDelay_);
+}
+
+void FractionalDelay::setDelay(float delay)
+{
+	targetDelay_ = clamp(delay, 1.f, maxDelay_);
+}
+
+void FractionalDelay::process(float* samples, int numSamples)
+{
+	const auto delayIncrement = (targetDelay_ - currentDelay_) / numSamples;
+	for (auto i = 0; i < numSamples; ++i)
+	{
+		buffer_[writeIndex_] = samples[i];
+
+		currentDelay_ += delayIncrement;
+		const auto integer = static_cast<int>(currentDelay_);
+		const auto d = currentDelay_ - integer + 1.f; // fractional delay measured from x[n - integer + 1]
+
+		// x0 is the newest of the four samples around the read position
+		const auto x0 = buffer_[(writeIndex_ - integer + 1) & mask_];
+		const auto x1 = buffer_[(writeIndex_ - integer) & mask_];
+		const auto x2 = buffer_[(writeIndex_ - integer - 1) & mask_];
+		const auto x3 = buffer_[(writeIndex_ - integer - 2) & mask_];
+		float weights[4];
+		getInterpolatorWeights(d, weights);
+		samples[i] = x0 * weights[0] + x1 * weights[1] + x2 * weights[2] + x3 * weights[3];
+
+		writeIndex_ = (writeIndex_ + 1) & mask_;
+	}
+	currentDelay_ = targetDelay_;
+}
+
+void FractionalDelay::reset()
+{
+	std::fill(buffer_.begin(), buffer_.end(), 0.f);
+	currentDelay_ = targetDelay_;
+}
+
+void FractionalDelay::delayImpulseResponse(const float* ir, int numTaps, float delay, float* out, int outLength)
+{
+	delay = std::max(1.f, delay);
+	const auto integer = static_cast<int>(delay);
+	float weights[4];
+	getInterpolatorWeights(delay - integer + 1.f, weights);
+
+	// The interpolator is an FIR filter starting at tap integer - 1
+	std::fill(out, out + outLength, 0.f);
+	for (auto j = 0; j < 4; ++j)
+		for (auto i = 0; i < numTaps; ++i)
+			out[integer - 1 + j + i] += weights[j] * ir[i];
+}
+
+void FractionalDelay::getInterpolatorWeights(float d, float* weights)
+{
+	// Third-order Lagrange
+	weights[0] = -(d - 1.f) * (d - 2.f) * (d - 3.f) / 6.f;
+	weights[1] = d * (d - 2.f) * (d - 3.f) / 2.f;
+	weights[2] = -d * (d - 1.f) * (d - 3.f) / 2.f;
+	weights[3] = d * (d - 1.f) * (d - 2.f) / 6.f;
+}
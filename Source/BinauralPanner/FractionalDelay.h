@@ -0,0 +1,34 @@
+#pragma once
+#include <vector>
+
+/** Single-channel delay line with a fractional delay, used to put back the onset delay
+	that minimum-phase HRIRs leave out (see MinimumPhase.h).
+	Reads with third-order Lagrange interpolation, so the delay can't go below one sample.
+	A new delay is reached by gliding over the next processed block, which keeps moving
+	sources free of clicks.
+	Expected calling order: prepare(), setDelay() when the delay changes, process()
+*/
+class FractionalDelay
+{
+public:
+	void prepare(float maxDelay);
+	void setDelay(float delay);
+	void process(float* samples, int numSamples);
+	void reset();
+
+	// Renders a fixed delay into an impulse response: out is ir as process() would delay it
+	// once it has reached delay. out needs room for numTaps + delay + 3 samples, the rest is zeroed.
+	static void delayImpulseResponse(const float* ir, int numTaps, float delay, float* out, int outLength);
+
+private:
+	// Weights of the four samples around the read position, newest first, for a fractional
+	// delay d in [1, 2) measured from the newest
+	static void getInterpolatorWeights(float d, float* weights);
+
+	std::vector<float> buffer_;
+	int mask_ = 0;
+	int writeIndex_ = 0;
+	float maxDelay_ = 1.f;
+	float currentDelay_ = 1.f;
+	float targetDelay_ = 1.f;
+};
@@ -1,75 +1,235 @@
 #include "HRIRFilter.h"
+#include "VectorOps.h"
 
-namespace
+
+void HRIRFilter::prepare(int newPartitionSize, int irLength, Mode newMode)
 {
-	void freqDomainMultiplyWithCrossfade(const ComplexVector<float>& inputDFT, 
-		const ComplexVector<float>& targetFilter,
-		const ComplexVector<float>& currentFilter,
-		ComplexVector<float>& outputDFT)
+	jassert(isPowerOf2(newPartitionSize));
+	mode = newMode;
+	partitionSize = newPartitionSize;
+	numPartitions = std::max(1, (irLength + partitionSize - 1) / partitionSize);
+	firstFFTPartition = mode == Mode::ZeroLatency ? 1 : 0;
+	numFFTPartitions = numPartitions - firstFFTPartition;
+	const auto nfft = getFFTSize();
+	numBins = nfft / 2 + 1;
+	fft = FFT::create(nfft);
+	for (auto i = 0; i < 2; ++i)
 	{
-		const auto& X = inputDFT;
-		const auto& H0 = currentFilter;
-		const auto& H1 = targetFilter;
-		outputDFT[0] = X[0] * (H0[0] + H1[0]) + 0.5f * X[1] * (-H0[1] + H1[1]);
-		for (auto i = 1u; i < outputDFT.size() - 1; ++i)
+		for (auto& tf : transferFunction[i])
+			tf.assign(numFFTPartitions * numBins, {});
+		filteredDFT[i].resize(numBins);
+		outputDFT[i].resize(numBins);
+		outputBuffer[i].assign(nfft, 0.f);
+	}
+	inputDFTs.resize(numFFTPartitions * numBins);
+	zeroPaddedIR.resize(nfft);
+	crossfadePending = false;
+
+	headLength = mode == Mode::ZeroLatency ? std::min(partitionSize, std::max(1, irLength)) : 0;
+	for (auto ear = 0; ear < 2; ++ear)
+	{
+		pendingHead[ear].assign(headLength, 0.f);
+		for (auto i = 0; i < 2; ++i)
 		{
-			outputDFT[i] = 0.5f * X[i - 1] * (-H0[i - 1] + H1[i - 1])
-				+ X[i] * (H0[i] + H1[i])
-				+ 0.5f * X[i + 1] * (-H0[i + 1] + H1[i + 1]);
+			head[i][ear].assign(headLength, 0.f);
+			headOutput[i][ear].resize(headLength > 0 ? partitionSize : 0);
 		}
-		const auto sz = outputDFT.size() - 1;
-		outputDFT[sz] = 0.5f * X[sz - 1] * (-H0[sz - 1] + H1[sz - 1]) + X[sz] * (H0[sz] + H1[sz]);
 	}
+	// The window the FFT crossfade puts on the output half of the frame, see VectorOps::crossfade()
+	crossfadeRamp.resize(headLength > 0 ? partitionSize : 0);
+	for (size_t i = 0; i < crossfadeRamp.size(); ++i)
+		crossfadeRamp[i] = 0.5f * (1.f - std::cos(Pi * i / partitionSize));
+	headCrossfading = false;
+
+	// Rounded up to keep the halves as aligned as the buffer, the FIR is sensitive to it
+	historySize = (std::max(0, headLength - 1) + 15) & ~15;
+	inputBuffer.resize(historySize + nfft);
+	reset();
 }
 
+void HRIRFilter::setImpulseResponse(const HRIRBuffer& hrir)
+{
+	// Several changes within one partition crossfade from what was last heard to the newest
+	if (!crossfadePending)
+		currentTargetFilterIndex ^= 1;
+	setImpulseResponse(hrir.leftEarIR, 0);
+	setImpulseResponse(hrir.rightEarIR, 1);
+	crossfadePending = true;
+}
 
-void HRIRFilter::setImpulseResponse(const HRIRBuffer::ImpulseResponse& impulseResponse)
+void HRIRFilter::setImpulseResponse(const HRIRBuffer::ImpulseResponse& impulseResponse, int ear)
 {
-	currentTargetFilterIndex ^= 1;
-	auto& zeroPadIR = zeroPaddedIR[currentTargetFilterIndex];
-	std::copy(impulseResponse.begin(), impulseResponse.end(), zeroPadIR.begin());
-	oouraFFT.fft(zeroPadIR.data(), transferFunction[currentTargetFilterIndex].data());
+	const auto irLength = static_cast<int>(impulseResponse.size());
+	if (headLength > 0)
+	{
+		const auto end = std::min(headLength, irLength);
+		std::copy(impulseResponse.begin(), impulseResponse.begin() + end, pendingHead[ear].begin());
+		std::fill(pendingHead[ear].begin() + end, pendingHead[ear].end(), 0.f);
+	}
+
+	auto& tf = transferFunction[currentTargetFilterIndex][ear];
+	for (auto partition = firstFFTPartition; partition < numPartitions; ++partition)
+	{
+		// Each partition is zero padded to twice its size
+		const auto start = std::min(partition * partitionSize, irLength);
+		const auto end = std::min(start + partitionSize, irLength);
+		std::fill(zeroPaddedIR.begin(), zeroPaddedIR.end(), 0.f);
+		std::copy(impulseResponse.begin() + start, impulseResponse.begin() + end, zeroPaddedIR.begin());
+		fft->fft(zeroPaddedIR.data(), &tf[(partition - firstFFTPartition) * numBins]);
+	}
 }
 
-void HRIRFilter::prepare(int samplesPerBlock)
+void HRIRFilter::setTransferFunction(const HRTFBuffer& hrtf)
 {
-	// block size must be power of 2 and nfft twice the size of it
-	jassert(isPowerOf2(samplesPerBlock));
-	nfft = 2 * samplesPerBlock;
-	oouraFFT.init(nfft);
-	for (auto i = 0; i < 2; ++i)
+	jassert(static_cast<int>(hrtf.leftEarTF.size()) == numPartitions * numBins);
+	jassert(static_cast<int>(hrtf.rightEarTF.size()) == numPartitions * numBins);
+	if (!crossfadePending)
+		currentTargetFilterIndex ^= 1;
+	const ComplexVector<float>* tfs[] = {&hrtf.leftEarTF, &hrtf.rightEarTF};
+	for (auto ear = 0; ear < 2; ++ear)
 	{
-		zeroPaddedIR[i].resize(nfft);
-		transferFunction[i].resize(nfft / 2 + 1);
+		const auto& tf = *tfs[ear];
+		std::copy(tf.begin() + firstFFTPartition * numBins, tf.end(), transferFunction[currentTargetFilterIndex][ear].begin());
+		if (headLength > 0)
+		{
+			// The head comes back from the first partition's spectrum, scaled like the filter output
+			fft->ifft(tf.data(), zeroPaddedIR.data());
+			const auto scale = 2.f / getFFTSize();
+			for (auto i = 0; i < headLength; ++i)
+				pendingHead[ear][i] = scale * zeroPaddedIR[i];
+		}
+	}
+	crossfadePending = true;
+}
+
+void HRIRFilter::process(const float* in, float* left, float* right, int numSamples)
+{
+	// The FFT output lags input by one partition: each sample taken in swaps with one
+	// from the partition processed before. In Mode::ZeroLatency the FFTs leave out the
+	// first partition of the IRs, so what is one partition late is on time, and the head adds the rest.
+	while (numSamples > 0)
+	{
+		const auto n = std::min(numSamples, partitionSize - partitionPosition);
+		auto* gathered = getInputHalf(newestHalf) + partitionPosition;
+		const auto* outL = outputBuffer[0].data() + partitionSize + partitionPosition;
+		const auto* outR = outputBuffer[1].data() + partitionSize + partitionPosition;
+		std::copy(in, in + n, gathered);
+		if (newestHalf == 1 && partitionPosition + n > partitionSize - historySize)
+		{
+			// The end of half 1 is also the history of half 0
+			const auto start = std::max(partitionPosition, partitionSize - historySize);
+			std::copy(getInputHalf(1) + start, gathered + n, inputBuffer.data() + start - (partitionSize - historySize));
+		}
+		for (auto i = 0; i < n; ++i)
+		{
+			left[i] = outputScale * outL[i];
+			right[i] = outputScale * outR[i];
+		}
+		if (headLength > 0)
+			processHead(gathered, left, right, n);
+
+		partitionPosition += n;
+		in += n;
+		left += n;
+		right += n;
+		numSamples -= n;
+		if (partitionPosition == partitionSize)
+		{
+			processPartition();
+			partitionPosition = 0;
+			newestHalf ^= 1;
+		}
 	}
-	inputDFT.resize(nfft / 2 + 1);
-	outputDFT.resize(nfft / 2 + 1);
-	inputBuffer.resize(nfft);
-	outputBuffer.resize(nfft);
 }
 
-void HRIRFilter::process(float* samples, int numSamples)
+void HRIRFilter::processHead(const float* x, float* left, float* right, int numSamples)
 {
-	//jassert(numSamples == nfft / 2);
-	// overlap-save: we are buffering nfft input samples
-	// shift to the left and buffer numSamples of input
-	std::copy(inputBuffer.begin() + numSamples, inputBuffer.end(), inputBuffer.begin());
-	std::copy(samples, samples + numSamples, inputBuffer.data() + numSamples);
-	oouraFFT.fft(inputBuffer.data(), inputDFT.data());
-
-	freqDomainMultiplyWithCrossfade(inputDFT, transferFunction[currentTargetFilterIndex],
-		transferFunction[currentTargetFilterIndex ^ 1], outputDFT);
-
-	oouraFFT.ifft(outputDFT.data(), outputBuffer.data());
-	// overlap-save: discard leftmost (nfft - numSamples) samples
-	const auto scale = 1.f / nfft;
+	if (!headCrossfading)
+	{
+		VectorOps::fir(x, head[1][0].data(), head[1][1].data(), headLength, left, right, numSamples);
+		return;
+	}
+
+	// Fade between both heads the way the FFT partitions fade
+	for (auto i = 0; i < 2; ++i)
+	{
+		std::fill_n(headOutput[i][0].begin(), numSamples, 0.f);
+		std::fill_n(headOutput[i][1].begin(), numSamples, 0.f);
+		VectorOps::fir(x, head[i][0].data(), head[i][1].data(), headLength, headOutput[i][0].data(), headOutput[i][1].data(), numSamples);
+	}
+	const auto* ramp = crossfadeRamp.data() + partitionPosition;
 	for (auto i = 0; i < numSamples; ++i)
 	{
-		samples[i] = scale * outputBuffer[i + numSamples];
+		left[i] += headOutput[0][0][i] + ramp[i] * (headOutput[1][0][i] - headOutput[0][0][i]);
+		right[i] += headOutput[0][1][i] + ramp[i] * (headOutput[1][1][i] - headOutput[0][1][i]);
+	}
+}
+
+void HRIRFilter::processPartition()
+{
+	// The head switches to the latest filter over the same partition as the FFT output
+	if (headLength > 0)
+	{
+		headCrossfading = crossfadePending;
+		if (crossfadePending)
+		{
+			for (auto ear = 0; ear < 2; ++ear)
+			{
+				std::swap(head[0][ear], head[1][ear]);
+				std::copy(pendingHead[ear].begin(), pendingHead[ear].end(), head[1][ear].begin());
+			}
+		}
 	}
+	if (numFFTPartitions == 0)
+	{
+		crossfadePending = false;
+		return;
+	}
+
+	// overlap-save: the frame holds the previous and the newest partition, read from
+	// the two halves of the ring in that order. One forward transform serves both ears.
+	newestInputDFT = (newestInputDFT + 1) % numFFTPartitions;
+	fft->fft(getInputHalf(newestHalf ^ 1), getInputHalf(newestHalf), &inputDFTs[newestInputDFT * numBins]);
+
+	// Partition k of the filter applies to the frame k partitions old
+	auto filter = [this](const ComplexVector<float>& tf, std::complex<float>* out)
+	{
+		VectorOps::complexMultiply(&inputDFTs[newestInputDFT * numBins], tf.data(), 1.f, out, numBins);
+		for (auto k = 1; k < numFFTPartitions; ++k)
+		{
+			const auto frame = (newestInputDFT - k + numFFTPartitions) % numFFTPartitions;
+			VectorOps::complexMultiplyAdd(&inputDFTs[frame * numBins], &tf[k * numBins], out, numBins);
+		}
+	};
+
+	// Crossfade over one partition after a filter change, then filter with the new one only.
+	// The crossfade doubles the level, which the output scale takes back.
+	const auto nfft = getFFTSize();
+	for (auto ear = 0; ear < 2; ++ear)
+	{
+		if (crossfadePending)
+		{
+			filter(transferFunction[currentTargetFilterIndex ^ 1][ear], filteredDFT[0].data());
+			filter(transferFunction[currentTargetFilterIndex][ear], filteredDFT[1].data());
+			VectorOps::crossfade(filteredDFT[0].data(), filteredDFT[1].data(), outputDFT[ear].data(), numBins);
+		}
+		else
+			filter(transferFunction[currentTargetFilterIndex][ear], outputDFT[ear].data());
+	}
+	outputScale = (crossfadePending ? 1.f : 2.f) / nfft;
+	crossfadePending = false;
+
+	// overlap-save: the first half of the result is aliased, process() plays out the second
+	fft->ifftPair(outputDFT[0].data(), outputDFT[1].data(), outputBuffer[0].data(), outputBuffer[1].data());
 }
 
 void HRIRFilter::reset()
 {
 	std::fill(inputBuffer.begin(), inputBuffer.end(), 0.f);
+	for (auto& buffer : outputBuffer)
+		std::fill(buffer.begin(), buffer.end(), 0.f);
+	std::fill(inputDFTs.begin(), inputDFTs.end(), std::complex<float>());
+	newestInputDFT = 0;
+	partitionPosition = 0;
+	newestHalf = 0;
 }
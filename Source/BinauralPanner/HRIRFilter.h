@@ -1,28 +1,80 @@
 #pragma once
-#include "OouraFFT.h"
+#include "FFT.h"
 #include "HRTFContainer.h"
 #include "Util.h"
 
-/** Single-channel (left or right) HRIR filter.
-    Uses frequency-domain crossfading to avoid audio waveform discontinuities that arise when changing the impulse response.
-    Expected calling order: setImpulseResponse(), process()
+/** Filters one source through the HRIRs of both ears.
+	Uniformly partitioned overlap-save convolution: the IRs are split into partitions of a fixed size
+	chosen in prepare(), independent of the host's block size. Input is gathered into whole partitions,
+	so process() takes any number of samples, at a constant latency of getLatency() samples.
+	Both ears share the forward transform of each partition, and their inverse transforms are
+	packed into one complex transform where the FFT backend can, see FFT::ifftPair().
+	In Mode::ZeroLatency the first partition of the IRs is instead applied sample by sample as a
+	direct-form FIR, and the partitions after it, being due one partition late anyway, come from
+	the FFTs: nothing is added to the latency, at the cost of partitionSize multiplies per sample and ear.
+	Uses frequency-domain crossfading to avoid audio waveform discontinuities that arise when changing the impulse response.
+	Expected calling order: prepare(), setImpulseResponse() or setTransferFunction() when the filter changes, process()
 */
 class HRIRFilter
 {
 public:
-	void setImpulseResponse(const HRIRBuffer::ImpulseResponse& impulseResponse);
-	void prepare(int samplesPerBlock);
-	void process(float* samples, int numSamples);
+	enum class Mode
+	{
+		Partitioned, // all partitions by FFT, getLatency() is the partition size
+		ZeroLatency // direct-form head, FFT partitions for the rest
+	};
+
+	// partitionSize must be a power of 2; IRs longer than irLength are truncated
+	void prepare(int partitionSize, int irLength, Mode mode = Mode::Partitioned);
+	void setImpulseResponse(const HRIRBuffer& hrir);
+	// The transfer functions must hold getNumPartitions() spectra of getFFTSize() / 2 + 1 bins,
+	// e.g. from HRTFContainer::hrtf()
+	void setTransferFunction(const HRTFBuffer& hrtf);
+	int getFFTSize() const { return 2 * partitionSize; }
+	int getNumPartitions() const { return numPartitions; }
+	int getLatency() const { return mode == Mode::ZeroLatency ? 0 : partitionSize; }
+	// in may be the same buffer as left or right
+	void process(const float* in, float* left, float* right, int numSamples);
 	void reset();
 
 private:
-	OouraFFT oouraFFT;
-	ComplexVector<float> transferFunction[2];
-	ComplexVector<float> inputDFT;
-	ComplexVector<float> outputDFT;
-	std::vector<float> zeroPaddedIR[2];
+	void setImpulseResponse(const HRIRBuffer::ImpulseResponse& impulseResponse, int ear);
+	void processPartition();
+	// Adds the direct-form head for the next numSamples of x, which is in inputBuffer
+	void processHead(const float* x, float* left, float* right, int numSamples);
+	float* getInputHalf(int half) { return inputBuffer.data() + historySize + half * partitionSize; }
+
+	std::unique_ptr<FFT> fft;
+	ComplexVector<float> transferFunction[2][2]; // [filter][ear], each [FFT partition][bin]
+	ComplexVector<float> inputDFTs; // spectra of the last numPartitions input frames, [frame][bin]
+	ComplexVector<float> filteredDFT[2]; // newest frame through each filter during a crossfade
+	ComplexVector<float> outputDFT[2]; // [ear]
+	std::vector<float> zeroPaddedIR;
+	// A ring of two partitions, so the window slides without moving samples: the newest is
+	// gathered into half newestHalf, the other holds the one before. In Mode::ZeroLatency
+	// the last historySize samples of half 1 are also kept ahead of half 0, so the head
+	// finds the history of either half right before it.
 	std::vector<float> inputBuffer;
-	std::vector<float> outputBuffer;
+	int historySize = 0;
+	int newestHalf = 0;
+	std::vector<float> outputBuffer[2]; // [ear], second half is the output of the last partition
+	Mode mode = Mode::Partitioned;
+	int partitionSize = 0;
+	int numPartitions = 0; // of the IRs
+	int firstFFTPartition = 0; // 1 in Mode::ZeroLatency, where the head takes the first
+	int numFFTPartitions = 0;
+	int numBins = 0;
+	int newestInputDFT = 0;
+	int partitionPosition = 0; // samples gathered into the current partition
+	float outputScale = 0.f;
 	int currentTargetFilterIndex = 0;
-	size_t nfft = 0u;
+	bool crossfadePending = false;
+
+	// Mode::ZeroLatency
+	int headLength = 0;
+	std::vector<float> pendingHead[2]; // [ear], from the last filter change
+	std::vector<float> head[2][2]; // [current, target][ear]
+	std::vector<float> headOutput[2][2]; // [current, target][ear] while crossfading
+	std::vector<float> crossfadeRamp; // target's share of the output over a crossfade partition
+	bool headCrossfading = false;
 };
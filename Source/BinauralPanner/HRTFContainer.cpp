@@ -1,195 +1,240 @@
-#pragma warning(push)
-#include "delaunay/delaunay.h"
+#include <cmath>
+#include <cstring>
 #include "HRTFContainer.h"
+#include "FractionalDelay.h"
 
 
-HRTFContainer::HRTFContainer()
+HRTFContainer::HRTFContainer(const HRTFDatabase::LoadOptions& options)
 {
 	jassert(hrirReadIndex.is_lock_free());
 	hrirReadIndex = 0;
-	hrir_[0] = {};
-	hrir_[1] = {};
+	hrtfReadIndex = 0;
+	jassert(requestedPosition_.is_lock_free());
+	requestedPosition_ = NO_POSITION;
+	setDatabase(library_->getDefault(options));
 }
 
 HRTFContainer::~HRTFContainer()
 {
+	worker_->removeTimeSliceClient(this);
 }
 
-#ifdef TPP
-void HRTFContainer::updateHRIR(double azimuth, double elevation)
-{
-  if (triangulation_ == nullptr)
-    return;
-  
-  // Iterate through all the faces of the triangulation
-  for (auto fit = triangulation_->fbegin(); fit != triangulation_->fend(); ++fit)
-  {
-    const auto vertexA = triangulation_->Org(fit);
-    const auto vertexB = triangulation_->Dest(fit);
-    const auto vertexC = triangulation_->Apex(fit);
-    const auto A = triangulation_->point_at_vertex_id(vertexA);
-    const auto B = triangulation_->point_at_vertex_id(vertexB);
-    const auto C = triangulation_->point_at_vertex_id(vertexC);
-    
-    const double T[] = {A[0] - C[0], A[1] - C[1],
-      B[0] - C[0], B[1] - C[1]};
-    double invT[] = {T[3], -T[1], -T[2], T[0]};
-    const auto det = 1 / (T[0] * T[3] - T[1] * T[2]);
-    for (auto i = 0; i < 4; ++i)
-      invT[i] *= det;
-    
-    const double X[] = {azimuth - C[0], elevation - C[1]};
-    
-    // Barycentric coordinates of point X
-    const auto g1 = static_cast<float>(invT[0] * X[0] + invT[2] * X[1]);
-    const auto g2 = static_cast<float>(invT[1] * X[0] + invT[3] * X[1]);
-    const auto g3 = 1 - g1 - g2;
-    
-    // If any of the barycentric coordinate is negative, the point
-    // does not lay inside the triangle, so continue the loop.
-    if (g1 < 0 || g2 < 0 || g3 < 0)
-      continue;
-    else
-    {
-      auto& irA = hrirDict_[(int)A[0]][getElvIndex(std::lround(A[1]))];
-      auto& irB = hrirDict_[(int)B[0]][getElvIndex(std::lround(B[1]))];
-      auto& irC = hrirDict_[(int)C[0]][getElvIndex(std::lround(C[1]))];
-      const auto hrirWriteIndex = hrirReadIndex ^ 1;
-      auto& hrirBuffer = hrir_[hrirWriteIndex];
-      
-      // Fill HRIR array and return
-      for (size_t i = 0; i < hrirBuffer.HRIR_SIZE; ++i)
-      {
-        hrirBuffer.leftEarIR[i] = g1 * irA.leftEarIR[i] + g2 * irB.leftEarIR[i] + g3 * irC.leftEarIR[i];
-        hrirBuffer.rightEarIR[i] = g1 * irA.rightEarIR[i] + g2 * irB.rightEarIR[i] + g3 * irC.rightEarIR[i];
-      }
-      return;
-    }
-  }
-  // If the query point was not found , return zero-ed impulse response
-  return;
-}
-#else
-void HRTFContainer::updateHRIR(double azimuth, double elevation)
-{
-	if (!triangulation_)
-		return;
-
-	const auto& triangles = triangulation_->getTriangles();
-	// Iterate through all the faces of the triangulation
- 	for (auto& triangle : triangles)
+bool HRTFContainer::loadHRTFSet(const File& file, const HRTFDatabase::LoadOptions& options)
+{
+	auto database = file == File::nonexistent ? library_->getDefault(options)
+		: library_->getFromFile(file, options);
+	if (database == nullptr)
+		return false;
+	setDatabase(database);
+	return true;
+}
+
+void HRTFContainer::setDatabase(HRTFDatabase::Ptr database)
+{
+	const WorkerPause pause(*this);
+	database_ = database;
+	hrir_[0].setSize(database_->getIRLength());
+	hrir_[1].setSize(database_->getIRLength());
+	if (spectra_ != nullptr)
+		prepare(spectra_->fftSize, withDelays_);
+	else
+		updateLookupTable();
+}
+
+void HRTFContainer::prepare(int fftSize, bool withDelays)
+{
+	const WorkerPause pause(*this);
+	spectra_ = database_->getSpectra(fftSize);
+	withDelays_ = withDelays;
+	numPartitions_ = spectra_->numPartitions;
+	if (withDelays_)
 	{
-		const auto A = triangle.p1;
-		const auto B = triangle.p2;
-		const auto C = triangle.p3;
-
-		const double T[] = {A.x - C.x, A.y - C.y, B.x - C.x, B.y - C.y};
-		double invT[] = {T[3], -T[1], -T[2], T[0]};
-		const auto det = T[0] * T[3] - T[1] * T[2];
-		jassert(det != 0 && "Bad triangulation!");
-		for (auto i = 0; i < 4; ++i)
-			invT[i] /= det;
-		const double X[] = {azimuth - C.x, elevation - C.y};
-
-		// Barycentric coordinates of point X
-		const auto g1 = static_cast<float>(invT[0] * X[0] + invT[2] * X[1]);
-		const auto g2 = static_cast<float>(invT[1] * X[0] + invT[3] * X[1]);
-		const auto g3 = 1 - g1 - g2;
-
-		// If any of the barycentric coordinate is negative, the point
-		// does not lay inside the triangle, so continue the loop.
-		if (g1 < 0 || g2 < 0 || g3 < 0)
-			continue;
-		auto& irA = hrirDict_[static_cast<int>(A.x)][getElvIndex(std::lround(A.y))];
-		auto& irB = hrirDict_[static_cast<int>(B.x)][getElvIndex(std::lround(B.y))];
-		auto& irC = hrirDict_[static_cast<int>(C.x)][getElvIndex(std::lround(C.y))];
-		const auto hrirWriteIndex = hrirReadIndex ^ 1;
-		auto& hrirBuffer = hrir_[hrirWriteIndex];
-		for (auto i = 0u; i < hrirBuffer.HRIR_SIZE; ++i)
-		{
-			hrirBuffer.leftEarIR[i] = g1 * irA.leftEarIR[i] + g2 * irB.leftEarIR[i] + g3 * irC.leftEarIR[i];
-			hrirBuffer.rightEarIR[i] = g1 * irA.rightEarIR[i] + g2 * irB.rightEarIR[i] + g3 * irC.rightEarIR[i];
-		}
-		hrirReadIndex = hrirWriteIndex;
-		return;
+		// The delays lengthen the IRs by the longest of them and the interpolator, see FractionalDelay
+		const auto partitionSize = fftSize / 2;
+		const auto delayedLength = getIRLength() + static_cast<int>(std::ceil(getMaxDelay())) + 3;
+		numPartitions_ = (delayedLength + partitionSize - 1) / partitionSize;
+		for (auto& transform : delayedTransforms_)
+			transform.prepare(fftSize, numPartitions_, getIRLength());
 	}
+	const auto tfSize = numPartitions_ * spectra_->numBins;
+	hrtf_[0].setSize(tfSize);
+	hrtf_[1].setSize(tfSize);
+	asyncHRTF_.resetAll([tfSize](HRTFBuffer& buffer) { buffer.setSize(tfSize); });
+	updateLookupTable();
+}
+
+void HRTFContainer::setLookupTableResolution(double azimuthStep, double elevationStep)
+{
+	const WorkerPause pause(*this);
+	lookupAzimuthStep_ = azimuthStep;
+	lookupElevationStep_ = elevationStep;
+	updateLookupTable();
+}
+
+size_t HRTFContainer::getLookupTableMemorySize() const
+{
+	const auto& table = hrtfTable_ != nullptr ? hrtfTable_ : hrirTable_;
+	return table != nullptr ? table->getMemorySize() : 0;
+}
+
+void HRTFContainer::updateLookupTable()
+{
+	if (lookupAzimuthStep_ <= 0. || lookupElevationStep_ <= 0.)
+	{
+		hrirTable_ = nullptr;
+		hrtfTable_ = nullptr;
+	}
+	else if (spectra_ != nullptr && !withDelays_)
+	{
+		hrtfTable_ = database_->getLookupTable(lookupAzimuthStep_, lookupElevationStep_, spectra_.get());
+		hrirTable_ = nullptr;
+	}
+	else
+	{
+		hrirTable_ = database_->getLookupTable(lookupAzimuthStep_, lookupElevationStep_);
+		hrtfTable_ = nullptr;
+	}
+}
+
+bool HRTFContainer::updateHRIR(double azimuth, double elevation)
+{
+	const auto hrirWriteIndex = hrirReadIndex ^ 1;
+	// If the query point was not found, keep the previous impulse response
+	const auto found = interpolateHRIR(azimuth, elevation, hrir_[hrirWriteIndex]);
+	if (found)
+		hrirReadIndex = hrirWriteIndex;
+	return found;
+}
+
+bool HRTFContainer::interpolateHRIR(double azimuth, double elevation, HRIRBuffer& result) const
+{
+	return hrirTable_ != nullptr
+		? database_->lookupHRIR(azimuth, elevation, *hrirTable_, result)
+		: database_->interpolateHRIR(azimuth, elevation, result);
 }
-#endif
 
 const HRIRBuffer& HRTFContainer::hrir() const
 {
 	return hrir_[hrirReadIndex];
 }
 
-#ifdef TPP
-void HRTFContainer::loadHrir()
-{
-  MemoryInputStream istream(BinaryData::kemar_bin, BinaryData::kemar_binSize, false);
-  
-  std::vector<tpp::Delaunay::Point> points;
-  int azimuths[] = {-90, -80, -65, -55, -45, -40, -35, -30, -25, -20,
-    -15, -10, -5, 0, 5, 10, 15, 20, 25, 30, 35, 40, 45, 55, 65, 80, 90};
-  for (auto azm : azimuths)
-  {
-    
-    hrirDict_.insert(std::make_pair(azm, std::array<HRIRBuffer, 52>()));
-    // -90 deg
-    istream.read(hrirDict_[azm][0].leftEarIR.data(), 200 * sizeof(float));
-    istream.read(hrirDict_[azm][0].rightEarIR.data(), 200 * sizeof(float));
-    points.push_back(tpp::Delaunay::Point(azm, -90));
-    // 50 elevations
-    for (int i = 1; i < 51; ++i)
-    {
-      istream.read(hrirDict_[azm][i].leftEarIR.data(), 200 * sizeof(float));
-      istream.read(hrirDict_[azm][i].rightEarIR.data(), 200 * sizeof(float));
-      points.push_back(tpp::Delaunay::Point(azm, -45 + 5.625 * (i - 1)));
-    }
-    // 270 deg
-    istream.read(hrirDict_[azm][51].leftEarIR.data(), 200 * sizeof(float));
-    istream.read(hrirDict_[azm][51].rightEarIR.data(), 200 * sizeof(float));
-    points.push_back(tpp::Delaunay::Point(azm, 270));
-  }
-  triangulation_ = new tpp::Delaunay(points);
-  triangulation_->Triangulate();
-}
-#else
-void HRTFContainer::loadHrir()
-{
-  MemoryInputStream istream(BinaryData::kemar_bin, BinaryData::kemar_binSize, false);
-
-  std::vector<Vec2f> points;
-  int azimuths[] = {-90, -80, -65, -55, -45, -40, -35, -30, -25, -20,
-    -15, -10, -5, 0, 5, 10, 15, 20, 25, 30, 35, 40, 45, 55, 65, 80, 90};
-  for (auto& azm : azimuths)
-  {
-    hrirDict_.insert(std::make_pair(azm, std::array<HRIRBuffer, 52>()));
-    // -90 deg
-    istream.read(hrirDict_[azm][0].leftEarIR.data(), 200 * sizeof(float));
-    istream.read(hrirDict_[azm][0].rightEarIR.data(), 200 * sizeof(float));
-    points.push_back({static_cast<float>(azm), -90.f});
-    // 50 elevations
-    for (int i = 1; i < 51; ++i)
-    {
-      istream.read(hrirDict_[azm][i].leftEarIR.data(), 200 * sizeof(float));
-      istream.read(hrirDict_[azm][i].rightEarIR.data(), 200 * sizeof(float));
-      points.push_back({static_cast<float>(azm), -45.f + 5.625f * (i - 1)});
-    }
-    // 270 deg
-    istream.read(hrirDict_[azm][51].leftEarIR.data(), 200 * sizeof(float));
-    istream.read(hrirDict_[azm][51].rightEarIR.data(), 200 * sizeof(float));
-    points.push_back({static_cast<float>(azm), 270});
-  }
-  triangulation_ = new Delaunay();
-  triangulation_->triangulate(points);
-}
-#endif
-
-int HRTFContainer::getElvIndex(int elv)
-{
-	if (elv == -90)
-		return 0;
-	else if (elv == 270)
-		return 51;
-	else
-		return std::lroundf((elv + 45) / 5.625f);
+void HRTFContainer::updateHRTF(double azimuth, double elevation)
+{
+	jassert(spectra_ != nullptr);
+	const auto hrtfWriteIndex = hrtfReadIndex ^ 1;
+	// If the query point was not found, keep the previous transfer function
+	if (interpolateHRTF(azimuth, elevation, delayedTransforms_[0], hrtf_[hrtfWriteIndex]))
+		hrtfReadIndex = hrtfWriteIndex;
+}
+
+bool HRTFContainer::interpolateHRTF(double azimuth, double elevation, DelayedTransform& transform, HRTFBuffer& result)
+{
+	if (!withDelays_)
+	{
+		return hrtfTable_ != nullptr
+			? database_->lookupHRTF(azimuth, elevation, *hrtfTable_, result)
+			: database_->interpolateHRTF(azimuth, elevation, *spectra_, result);
+	}
+
+	if (!interpolateHRIR(azimuth, elevation, transform.hrir))
+		return false;
+	transform.apply(result);
+	return true;
+}
+
+const HRTFBuffer& HRTFContainer::hrtf() const
+{
+	return hrtf_[hrtfReadIndex];
+}
+
+void HRTFContainer::requestHRTF(double azimuth, double elevation)
+{
+	// Wake the worker only for a new position; a host calling this every block costs nothing more
+	const auto position = packPosition(static_cast<float>(azimuth), static_cast<float>(elevation));
+	if (requestedPosition_.exchange(position) != position)
+		worker_->moveToFrontOfQueue(this);
+}
+
+const HRTFBuffer* HRTFContainer::getNewHRTF()
+{
+	return asyncHRTF_.update() ? &asyncHRTF_.getReadBuffer() : nullptr;
+}
+
+int HRTFContainer::useTimeSlice()
+{
+	const auto position = requestedPosition_.load();
+	if (position == NO_POSITION || position == preparedPosition_)
+		return 100; // requestHRTF() wakes the worker; this only catches a wake that lands mid-slice
+
+	// Only the newest request is prepared; any made meanwhile are picked up next time
+	preparedPosition_ = position;
+	float azimuth, elevation;
+	unpackPosition(position, azimuth, elevation);
+
+	// If the query point was not found, keep the previous transfer function
+	if (interpolateHRTF(azimuth, elevation, delayedTransforms_[1], asyncHRTF_.getWriteBuffer()))
+		asyncHRTF_.publish();
+	return 0;
+}
+
+void HRTFContainer::DelayedTransform::prepare(int fftSize, int numPartitions, int irLength)
+{
+	fft = FFT::create(fftSize);
+	hrir.setSize(irLength);
+	delayedIR.assign(numPartitions * fftSize / 2, 0.f);
+	zeroPaddedIR.assign(fftSize, 0.f);
+}
+
+void HRTFContainer::DelayedTransform::apply(HRTFBuffer& result)
+{
+	// Partitioned as in HRTFDatabase::getSpectra()
+	const auto partitionSize = static_cast<int>(zeroPaddedIR.size()) / 2;
+	const auto numBins = partitionSize + 1;
+	const auto numPartitions = static_cast<int>(delayedIR.size()) / partitionSize;
+	const HRIRBuffer::ImpulseResponse* irs[] = {&hrir.leftEarIR, &hrir.rightEarIR};
+	const float delays[] = {hrir.leftEarDelay, hrir.rightEarDelay};
+	HRTFBuffer::TransferFunction* tfs[] = {&result.leftEarTF, &result.rightEarTF};
+	for (auto ear = 0; ear < 2; ++ear)
+	{
+		FractionalDelay::delayImpulseResponse(irs[ear]->data(), static_cast<int>(irs[ear]->size()), delays[ear],
+			delayedIR.data(), static_cast<int>(delayedIR.size()));
+		for (auto partition = 0; partition < numPartitions; ++partition)
+		{
+			const auto* start = &delayedIR[partition * partitionSize];
+			std::copy(start, start + partitionSize, zeroPaddedIR.begin());
+			fft->fft(zeroPaddedIR.data(), tfs[ear]->data() + partition * numBins);
+		}
+	}
+	result.leftEarDelay = 0.f;
+	result.rightEarDelay = 0.f;
+}
+
+uint64_t HRTFContainer::packPosition(float azimuth, float elevation)
+{
+	uint32_t bits[2];
+	std::memcpy(&bits[0], &azimuth, sizeof(float));
+	std::memcpy(&bits[1], &elevation, sizeof(float));
+	return (static_cast<uint64_t>(bits[0]) << 32) | bits[1];
+}
+
+void HRTFContainer::unpackPosition(uint64_t position, float& azimuth, float& elevation)
+{
+	const uint32_t bits[] = {static_cast<uint32_t>(position >> 32), static_cast<uint32_t>(position)};
+	std::memcpy(&azimuth, &bits[0], sizeof(float));
+	std::memcpy(&elevation, &bits[1], sizeof(float));
+}
+
+HRTFContainer::WorkerPause::WorkerPause(HRTFContainer& c)
+	: container(c)
+{
+	// Waits for a time slice in progress to finish
+	container.worker_->removeTimeSliceClient(&container);
+}
+
+HRTFContainer::WorkerPause::~WorkerPause()
+{
+	// Whatever was prepared may be stale now, so redo the latest request
+	container.preparedPosition_ = NO_POSITION;
+	if (container.spectra_ != nullptr)
+		container.worker_->addTimeSliceClient(&container);
 }
@@ -1,40 +1,131 @@
 #pragma once
-#include <array>
-#include <map>
 #include <atomic>
-#include "../JuceLibraryCode/JuceHeader.h"
+#include <cstdint>
+#include <memory>
+#include "FFT.h"
+#include "HRTFDatabase.h"
+#include "TripleBuffer.h"
 
-#include "triangle++/include/del_interface.hpp"
-struct HRIRBuffer
+/** Background thread shared by every HRTFContainer, on which requested transfer
+	functions are prepared away from the audio thread.
+*/
+class HRTFWorker : public TimeSliceThread
 {
-	static const auto HRIR_SIZE = 200u;
-	using ImpulseResponse = std::array<float, HRIR_SIZE>;
-
-	ImpulseResponse leftEarIR;
-	ImpulseResponse rightEarIR;
+public:
+	HRTFWorker() : TimeSliceThread("HRTF worker") { startThread(); }
+	~HRTFWorker() { stopThread(1000); }
 };
 
-class HRTFContainer
+/** Per-panner interpolation state on top of a shared HRTFDatabase.
+	Holds the most recently interpolated HRIR pair, double buffered so that hrir()
+	always returns a complete impulse response. Once prepare() has been called it can
+	also interpolate transfer functions directly, see updateHRTF(), or have them prepared
+	on the shared HRTFWorker, see requestHRTF().
+*/
+class HRTFContainer : private TimeSliceClient
 {
 public:
-	HRTFContainer();
+	// Starts with the built-in set, see loadHRTFSet()
+	explicit HRTFContainer(const HRTFDatabase::LoadOptions& options = HRTFDatabase::LoadOptions());
 	~HRTFContainer();
 
-	void updateHRIR(double azimuth, double elevation);
+	// Switches to the HRTF set in an .hrtf file, or back to the built-in set if the file is
+	// File::nonexistent. Allocates, so don't call it while updateHRIR() may be running.
+	// Returns false and keeps the current set if the file can't be loaded.
+	bool loadHRTFSet(const File& file, const HRTFDatabase::LoadOptions& options = HRTFDatabase::LoadOptions());
+
+	// Fetches the set's transfer functions, partitioned for fftSize (see HRTFDatabase::Spectra).
+	// With withDelays, the transfer functions from updateHRTF() and requestHRTF() have each
+	// ear's delay applied to its IR (see FractionalDelay::delayImpulseResponse()), and zero
+	// delays; they are then built from interpolated IRs, at a forward transform per partition
+	// and ear, and take getNumPartitions() partitions. Call from prepareToPlay().
+	void prepare(int fftSize, bool withDelays = false);
+	// Partitions in each ear's transfer function, once prepared
+	int getNumPartitions() const { return numPartitions_; }
+
+	// Returns false, keeping the previous impulse response, if the position is outside the set
+	bool updateHRIR(double azimuth, double elevation);
 	const HRIRBuffer& hrir() const;
 
-	void loadHrir();
+	// Frequency-domain equivalent of updateHRIR()/hrir(); needs prepare() first.
+	// A position change only costs a blend of three cached transfer functions per ear.
+	void updateHRTF(double azimuth, double elevation);
+	const HRTFBuffer& hrtf() const;
+
+	// Switches updateHRIR()/updateHRTF() to bilinear lookups in a table pre-interpolated every
+	// azimuthStep by elevationStep degrees (see HRTFDatabase::LookupTable), shared with every
+	// container using the same set and resolution. Once prepare() has been called only the
+	// transfer functions are tabulated, or only the IRs if prepared with delays. Pass 0 to go
+	// back to interpolating the measurements. Allocates, like loadHRTFSet().
+	void setLookupTableResolution(double azimuthStep, double elevationStep);
+	// Memory taken by the table in use, in bytes
+	size_t getLookupTableMemorySize() const;
+
+	// Asynchronous equivalent of updateHRTF()/hrtf(), for the audio thread; needs prepare() first.
+	// requestHRTF() records the position and wakes the worker; the worker interpolates the newest
+	// request and getNewHRTF() returns its result once, or nullptr until a newer one is ready.
+	// Neither call allocates. Waking takes the worker's queue lock, which it only holds briefly,
+	// and only happens when the position changes. Call both from the same thread.
+	void requestHRTF(double azimuth, double elevation);
+	const HRTFBuffer* getNewHRTF();
+
+	int getIRLength() const { return database_->getIRLength(); }
+	// Upper bound of the delays in hrir() and hrtf(), for sizing delay lines
+	float getMaxDelay() const { return database_->getMaxDelay(); }
+
 private:
-	static int getElvIndex(int elv);
+	void setDatabase(HRTFDatabase::Ptr database);
+	void updateLookupTable();
+	int useTimeSlice() override;
 
-	std::map<int, std::array<HRIRBuffer, 52>> hrirDict_;
+	bool interpolateHRIR(double azimuth, double elevation, HRIRBuffer& result) const;
 
-#ifdef TPP
-  ScopedPointer<tpp::Delaunay> triangulation_;
-#else
-  ScopedPointer<class Delaunay> triangulation_;
-#endif
+	// Work buffers for transfer functions with delays, one set per thread that builds them
+	struct DelayedTransform
+	{
+		void prepare(int fftSize, int numPartitions, int irLength);
+		void apply(HRTFBuffer& result);
+
+		std::unique_ptr<FFT> fft;
+		HRIRBuffer hrir;
+		std::vector<float> delayedIR;
+		std::vector<float> zeroPaddedIR;
+	};
+	bool interpolateHRTF(double azimuth, double elevation, DelayedTransform& transform, HRTFBuffer& result);
+
+	// Positions are passed to the worker as two floats in one lock-free word
+	static uint64_t packPosition(float azimuth, float elevation);
+	static void unpackPosition(uint64_t position, float& azimuth, float& elevation);
+	static const uint64_t NO_POSITION = ~uint64_t(0);
+
+	// Stops the worker from using this container while its state changes
+	struct WorkerPause
+	{
+		explicit WorkerPause(HRTFContainer& c);
+		~WorkerPause();
+		HRTFContainer& container;
+	};
+
+	SharedResourcePointer<HRTFDatabase::Library> library_;
+	HRTFDatabase::Ptr database_;
 
 	HRIRBuffer hrir_[2];
 	std::atomic_int hrirReadIndex;
+
+	std::shared_ptr<const HRTFDatabase::Spectra> spectra_;
+	HRTFBuffer hrtf_[2];
+	std::atomic_int hrtfReadIndex;
+	bool withDelays_ = false;
+	int numPartitions_ = 0;
+	DelayedTransform delayedTransforms_[2]; // for updateHRTF() and for the worker
+
+	double lookupAzimuthStep_ = 0.;
+	double lookupElevationStep_ = 0.;
+	std::shared_ptr<const HRTFDatabase::LookupTable> hrirTable_;
+	std::shared_ptr<const HRTFDatabase::LookupTable> hrtfTable_;
+
+	SharedResourcePointer<HRTFWorker> worker_;
+	std::atomic<uint64_t> requestedPosition_;
+	uint64_t preparedPosition_ = NO_POSITION; // worker thread only
+	TripleBuffer<HRTFBuffer> asyncHRTF_;
 };
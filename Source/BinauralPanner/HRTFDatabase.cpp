@@ -0,0 +1,664 @@
+#include <algorithm>
+#include "delaunay/delaunay.h"
+#include "CompactStorage.h"
+#include "FFT.h"
+#include "HRTFDatabase.h"
+#include "KemarGrid.h"
+#include "KemarTriangulation.h"
+#include "MinimumPhase.h"
+#include "VectorOps.h"
+
+#include "triangle++/include/del_interface.hpp"
+
+HRTFDatabase::Ptr HRTFDatabase::Library::getDefault(const LoadOptions& options)
+{
+	const ScopedLock sl(lock_);
+	auto& set = defaults_[options];
+	if (set == nullptr)
+		set = new HRTFDatabase(options);
+	return set;
+}
+
+HRTFDatabase::Ptr HRTFDatabase::Library::getFromFile(const File& file, const LoadOptions& options)
+{
+	const ScopedLock sl(lock_);
+	const auto key = std::make_pair(file.getFullPathName(), options);
+	auto& set = sets_[key];
+	if (set == nullptr)
+	{
+		Ptr newSet = new HRTFDatabase(file, options);
+		if (!newSet->isValid())
+		{
+			sets_.erase(key);
+			return nullptr;
+		}
+		set = newSet;
+	}
+	return set;
+}
+
+HRTFDatabase::HRTFDatabase(const LoadOptions& options)
+{
+	loadKemar();
+	if (options.minimumPhaseTaps > 0)
+		makeMinimumPhase(options.minimumPhaseTaps);
+	if (options.compactStorage)
+		makeCompact();
+	buildTriangulation();
+}
+
+HRTFDatabase::HRTFDatabase(const File& file, const LoadOptions& options)
+{
+	if (loadFile(file))
+	{
+		if (options.minimumPhaseTaps > 0)
+			makeMinimumPhase(options.minimumPhaseTaps);
+		if (options.compactStorage)
+			makeCompact();
+		buildTriangulation();
+	}
+	if (faces_.empty())
+	{
+		irData_ = nullptr;
+		mappedFile_ = nullptr;
+	}
+}
+
+HRTFDatabase::~HRTFDatabase()
+{
+}
+
+const HRTFDatabase::Face* HRTFDatabase::findFace(double azimuth, double elevation, float (&g)[3]) const
+{
+	const auto cell = getCellIndex(azimuth, elevation);
+	if (cell < 0)
+		return nullptr;
+
+	// Only the faces overlapping this grid cell can contain the point
+	for (auto i = cellStart_[cell]; i < cellStart_[cell + 1]; ++i)
+	{
+		const auto& face = faces_[cellFaces_[i]];
+		const auto& invT = face.invT;
+		const double X[] = {azimuth - face.originAzimuth, elevation - face.originElevation};
+
+		// Barycentric coordinates of point X
+		g[0] = static_cast<float>(invT[0] * X[0] + invT[2] * X[1]);
+		g[1] = static_cast<float>(invT[1] * X[0] + invT[3] * X[1]);
+		g[2] = 1 - g[0] - g[1];
+
+		// If any of the barycentric coordinate is negative, the point
+		// does not lay inside the triangle, so continue the loop.
+		if (g[0] < 0 || g[1] < 0 || g[2] < 0)
+			continue;
+		return &face;
+	}
+	// The query point was not found
+	return nullptr;
+}
+
+bool HRTFDatabase::interpolateHRIR(double azimuth, double elevation, HRIRBuffer& result) const
+{
+	jassert(result.leftEarIR.size() == static_cast<size_t>(irLength_));
+
+	float g[3];
+	const auto* face = findFace(azimuth, elevation, g);
+	if (face == nullptr)
+		return false;
+
+	for (auto ear = 0; ear < 2; ++ear)
+	{
+		const auto a = getIROffset(face->measurement[0], ear);
+		const auto b = getIROffset(face->measurement[1], ear);
+		const auto c = getIROffset(face->measurement[2], ear);
+		auto* out = (ear == 0 ? result.leftEarIR : result.rightEarIR).data();
+		if (isCompact())
+		{
+			// Expanding to float costs nothing extra: the scales go into the weights
+			const float scaledG[] = {g[0] * compactScales_[face->measurement[0] * 2 + ear],
+				g[1] * compactScales_[face->measurement[1] * 2 + ear], g[2] * compactScales_[face->measurement[2] * 2 + ear]};
+			const auto* data = compactData_.data();
+			VectorOps::blend3(data + a, data + b, data + c, scaledG, out, irLength_);
+		}
+		else
+		{
+			VectorOps::blend3(irData_ + a, irData_ + b, irData_ + c, g, out, irLength_);
+		}
+	}
+	interpolateDelays(*face, g, result.leftEarDelay, result.rightEarDelay);
+	return true;
+}
+
+bool HRTFDatabase::interpolateHRTF(double azimuth, double elevation, const Spectra& spectra, HRTFBuffer& result) const
+{
+	jassert(result.leftEarTF.size() == static_cast<size_t>(spectra.getTFSize()));
+
+	float g[3];
+	const auto* face = findFace(azimuth, elevation, g);
+	if (face == nullptr)
+		return false;
+
+	for (auto ear = 0; ear < 2; ++ear)
+	{
+		// The weights are real, so the spectra blend as plain floats
+		const auto* tfA = reinterpret_cast<const float*>(spectra.get(face->measurement[0], ear));
+		const auto* tfB = reinterpret_cast<const float*>(spectra.get(face->measurement[1], ear));
+		const auto* tfC = reinterpret_cast<const float*>(spectra.get(face->measurement[2], ear));
+		auto* out = reinterpret_cast<float*>((ear == 0 ? result.leftEarTF : result.rightEarTF).data());
+		VectorOps::blend3(tfA, tfB, tfC, g, out, 2 * spectra.getTFSize());
+	}
+	interpolateDelays(*face, g, result.leftEarDelay, result.rightEarDelay);
+	return true;
+}
+
+void HRTFDatabase::interpolateDelays(const Face& face, const float (&g)[3], float& left, float& right) const
+{
+	left = right = 0.f;
+	if (delays_.empty())
+		return;
+	for (auto vertex = 0; vertex < 3; ++vertex)
+	{
+		left += g[vertex] * delays_[face.measurement[vertex] * 2];
+		right += g[vertex] * delays_[face.measurement[vertex] * 2 + 1];
+	}
+}
+
+std::shared_ptr<const HRTFDatabase::Spectra> HRTFDatabase::getSpectra(int fftSize) const
+{
+	jassert(isPowerOf2(fftSize));
+	const ScopedLock sl(cacheLock_);
+
+	if (auto cached = spectra_[fftSize].lock())
+		return cached;
+
+	auto spectra = std::make_shared<Spectra>();
+	spectra->fftSize = fftSize;
+	spectra->numBins = fftSize / 2 + 1;
+	const auto partitionSize = fftSize / 2;
+	spectra->numPartitions = (irLength_ + partitionSize - 1) / partitionSize;
+	const auto numMeasurements = static_cast<int>(azimuths_.size() * elevations_.size());
+	spectra->data.resize(numMeasurements * 2 * spectra->getTFSize());
+
+	const auto fft = FFT::create(fftSize);
+	std::vector<float> ir(spectra->numPartitions * partitionSize);
+	std::vector<float> zeroPaddedIR(fftSize);
+	for (auto measurement = 0; measurement < numMeasurements; ++measurement)
+	{
+		for (auto ear = 0; ear < 2; ++ear)
+		{
+			copyIR(measurement, ear, ir.data(), irLength_);
+			auto* tf = &spectra->data[(measurement * 2 + ear) * spectra->getTFSize()];
+			for (auto partition = 0; partition < spectra->numPartitions; ++partition)
+			{
+				const auto* start = &ir[partition * partitionSize];
+				std::copy(start, start + partitionSize, zeroPaddedIR.begin());
+				fft->fft(zeroPaddedIR.data(), tf + partition * spectra->numBins);
+			}
+		}
+	}
+
+	spectra_[fftSize] = spectra;
+	return spectra;
+}
+
+std::shared_ptr<const HRTFDatabase::LookupTable> HRTFDatabase::getLookupTable(double azimuthStep,
+	double elevationStep, const Spectra* spectra) const
+{
+	jassert(azimuthStep > 0 && elevationStep > 0);
+	const ScopedLock sl(cacheLock_);
+
+	auto& cached = lookupTables_[std::make_tuple(azimuthStep, elevationStep, spectra != nullptr ? spectra->fftSize : 0)];
+	if (auto table = cached.lock())
+		return table;
+
+	auto table = std::make_shared<LookupTable>();
+	table->firstAzimuth = azimuths_.front();
+	table->firstElevation = elevations_.front();
+	table->azimuthStep = azimuthStep;
+	table->elevationStep = elevationStep;
+	table->numAzimuths = jmax(2, static_cast<int>(std::ceil((azimuths_.back() - azimuths_.front()) / azimuthStep)) + 1);
+	table->numElevations = jmax(2, static_cast<int>(std::ceil((elevations_.back() - elevations_.front()) / elevationStep)) + 1);
+	table->rowSize = spectra != nullptr ? 2 * spectra->getTFSize() : irLength_;
+	const auto numPoints = table->numAzimuths * table->numElevations;
+	table->data.resize(numPoints * 2 * table->rowSize);
+	if (isMinimumPhase())
+		table->delays.resize(numPoints * 2);
+
+	HRIRBuffer hrir;
+	HRTFBuffer hrtf;
+	if (spectra != nullptr)
+		hrtf.setSize(spectra->getTFSize());
+	else
+		hrir.setSize(irLength_);
+
+	// The measurement grid is rectangular, so its triangulation covers the whole table
+	// and only rounding on the border can make a point miss; those are nudged inwards.
+	const auto centreAzimuth = 0.5 * (azimuths_.front() + azimuths_.back());
+	const auto centreElevation = 0.5 * (elevations_.front() + elevations_.back());
+	for (auto azm = 0; azm < table->numAzimuths; ++azm)
+	{
+		for (auto elv = 0; elv < table->numElevations; ++elv)
+		{
+			auto azimuth = jmin(table->firstAzimuth + azm * azimuthStep, azimuths_.back());
+			auto elevation = jmin(table->firstElevation + elv * elevationStep, elevations_.back());
+			auto interpolate = [&]()
+			{
+				return spectra != nullptr ? interpolateHRTF(azimuth, elevation, *spectra, hrtf)
+					: interpolateHRIR(azimuth, elevation, hrir);
+			};
+			if (!interpolate())
+			{
+				azimuth += 1e-6 * (centreAzimuth - azimuth);
+				elevation += 1e-6 * (centreElevation - elevation);
+				const auto found = interpolate();
+				jassert(found);
+				ignoreUnused(found);
+			}
+
+			const auto point = azm * table->numElevations + elv;
+			auto* row = &table->data[point * 2 * table->rowSize];
+			if (spectra != nullptr)
+			{
+				const auto* left = reinterpret_cast<const float*>(hrtf.leftEarTF.data());
+				const auto* right = reinterpret_cast<const float*>(hrtf.rightEarTF.data());
+				std::copy(left, left + table->rowSize, row);
+				std::copy(right, right + table->rowSize, row + table->rowSize);
+			}
+			else
+			{
+				std::copy(hrir.leftEarIR.begin(), hrir.leftEarIR.end(), row);
+				std::copy(hrir.rightEarIR.begin(), hrir.rightEarIR.end(), row + table->rowSize);
+			}
+			if (!table->delays.empty())
+			{
+				table->delays[point * 2] = spectra != nullptr ? hrtf.leftEarDelay : hrir.leftEarDelay;
+				table->delays[point * 2 + 1] = spectra != nullptr ? hrtf.rightEarDelay : hrir.rightEarDelay;
+			}
+		}
+	}
+
+	cached = table;
+	return table;
+}
+
+bool HRTFDatabase::LookupTable::locate(double azimuth, double elevation, int (&points)[4], float (&weights)[4]) const
+{
+	const auto x = (azimuth - firstAzimuth) / azimuthStep;
+	const auto y = (elevation - firstElevation) / elevationStep;
+	if (x < 0 || y < 0 || x > numAzimuths - 1 || y > numElevations - 1)
+		return false;
+
+	// Points on the upper edges use the last cell
+	const auto azm = jmin(static_cast<int>(x), numAzimuths - 2);
+	const auto elv = jmin(static_cast<int>(y), numElevations - 2);
+	const auto fx = static_cast<float>(x - azm);
+	const auto fy = static_cast<float>(y - elv);
+
+	points[0] = azm * numElevations + elv;
+	points[1] = points[0] + 1;
+	points[2] = points[0] + numElevations;
+	points[3] = points[2] + 1;
+	weights[0] = (1 - fx) * (1 - fy);
+	weights[1] = (1 - fx) * fy;
+	weights[2] = fx * (1 - fy);
+	weights[3] = fx * fy;
+	return true;
+}
+
+namespace
+{
+	void blendTableRows(const HRTFDatabase::LookupTable& table, const int (&points)[4], const float (&weights)[4],
+		float* left, float* right, float& leftDelay, float& rightDelay)
+	{
+		for (auto ear = 0; ear < 2; ++ear)
+		{
+			const auto* a = &table.data[(points[0] * 2 + ear) * table.rowSize];
+			const auto* b = &table.data[(points[1] * 2 + ear) * table.rowSize];
+			const auto* c = &table.data[(points[2] * 2 + ear) * table.rowSize];
+			const auto* d = &table.data[(points[3] * 2 + ear) * table.rowSize];
+			auto* out = ear == 0 ? left : right;
+			for (auto i = 0; i < table.rowSize; ++i)
+				out[i] = weights[0] * a[i] + weights[1] * b[i] + weights[2] * c[i] + weights[3] * d[i];
+		}
+
+		leftDelay = rightDelay = 0.f;
+		if (table.delays.empty())
+			return;
+		for (auto corner = 0; corner < 4; ++corner)
+		{
+			leftDelay += weights[corner] * table.delays[points[corner] * 2];
+			rightDelay += weights[corner] * table.delays[points[corner] * 2 + 1];
+		}
+	}
+}
+
+bool HRTFDatabase::lookupHRIR(double azimuth, double elevation, const LookupTable& table, HRIRBuffer& result) const
+{
+	jassert(result.leftEarIR.size() == static_cast<size_t>(table.rowSize));
+
+	int points[4];
+	float weights[4];
+	if (!table.locate(azimuth, elevation, points, weights))
+		return false;
+
+	blendTableRows(table, points, weights, result.leftEarIR.data(), result.rightEarIR.data(),
+		result.leftEarDelay, result.rightEarDelay);
+	return true;
+}
+
+bool HRTFDatabase::lookupHRTF(double azimuth, double elevation, const LookupTable& table, HRTFBuffer& result) const
+{
+	jassert(2 * result.leftEarTF.size() == static_cast<size_t>(table.rowSize));
+
+	int points[4];
+	float weights[4];
+	if (!table.locate(azimuth, elevation, points, weights))
+		return false;
+
+	blendTableRows(table, points, weights, reinterpret_cast<float*>(result.leftEarTF.data()),
+		reinterpret_cast<float*>(result.rightEarTF.data()), result.leftEarDelay, result.rightEarDelay);
+	return true;
+}
+
+void HRTFDatabase::loadKemar()
+{
+	// kemar.bin is a headerless set on KemarGrid: per measurement, the left then the right IR
+	const auto irLength = 200;
+	const auto numFloats = KemarGrid::numVertices * 2 * irLength;
+	jassert(BinaryData::kemar_binSize == numFloats * static_cast<int>(sizeof(float)));
+
+	ownedData_.resize(numFloats);
+	MemoryInputStream istream(BinaryData::kemar_bin, BinaryData::kemar_binSize, false);
+	istream.read(ownedData_.data(), numFloats * sizeof(float));
+
+	irData_ = ownedData_.data();
+	irLength_ = irLength;
+	measurementStride_ = 2 * irLength;
+	earStride_ = irLength;
+	sampleRate_ = 44100.;
+
+	for (auto i = 0; i < KemarGrid::numAzimuths; ++i)
+		azimuths_.push_back(KemarGrid::azimuths[i]);
+	for (auto i = 0; i < KemarGrid::numElevations; ++i)
+		elevations_.push_back(KemarGrid::elevation(i));
+}
+
+bool HRTFDatabase::loadFile(const File& file)
+{
+#if JUCE_BIG_ENDIAN
+	// .hrtf files are little endian and used in place
+	ignoreUnused(file);
+	return false;
+#else
+	mappedFile_ = new MemoryMappedFile(file, MemoryMappedFile::readOnly);
+	const auto* data = static_cast<const char*>(mappedFile_->getData());
+	const auto size = mappedFile_->getSize();
+	if (data == nullptr || size < sizeof(HRTFFileHeader))
+		return false;
+
+	HRTFFileHeader header;
+	memcpy(&header, data, sizeof(header));
+	if (memcmp(header.magic, "HRTF", 4) != 0 || header.version != HRTFFileHeader::CURRENT_VERSION)
+		return false;
+	if (header.numEars != 2 || header.irLength == 0 || header.numAzimuths == 0 || header.numElevations == 0
+		|| header.earLayout > HRTFFileHeader::kEarsPlanar || header.headerSize % sizeof(float) != 0)
+		return false;
+
+	const auto gridSize = (header.numAzimuths + header.numElevations) * sizeof(float);
+	const auto numMeasurements = static_cast<size_t>(header.numAzimuths) * header.numElevations;
+	const auto dataSize = numMeasurements * header.numEars * header.irLength * sizeof(float);
+	if (header.headerSize < sizeof(HRTFFileHeader) + gridSize || size < header.headerSize + dataSize)
+		return false;
+
+	const auto* grid = reinterpret_cast<const float*>(data + sizeof(HRTFFileHeader));
+	azimuths_.assign(grid, grid + header.numAzimuths);
+	elevations_.assign(grid + header.numAzimuths, grid + header.numAzimuths + header.numElevations);
+
+	irData_ = reinterpret_cast<const float*>(data + header.headerSize);
+	irLength_ = static_cast<int>(header.irLength);
+	sampleRate_ = header.sampleRate;
+	if (header.earLayout == HRTFFileHeader::kEarsPerMeasurement)
+	{
+		measurementStride_ = 2 * irLength_;
+		earStride_ = irLength_;
+	}
+	else
+	{
+		measurementStride_ = irLength_;
+		earStride_ = static_cast<int>(numMeasurements) * irLength_;
+	}
+	return true;
+#endif
+}
+
+void HRTFDatabase::makeMinimumPhase(int numTaps)
+{
+	numTaps = jmin(numTaps, irLength_);
+	const auto numMeasurements = static_cast<int>(azimuths_.size() * elevations_.size());
+	std::vector<float> minimumPhaseData(numMeasurements * 2 * numTaps);
+	delays_.resize(numMeasurements * 2);
+
+	MinimumPhase minimumPhase(irLength_);
+	for (auto measurement = 0; measurement < numMeasurements; ++measurement)
+	{
+		for (auto ear = 0; ear < 2; ++ear)
+		{
+			auto* out = &minimumPhaseData[(measurement * 2 + ear) * numTaps];
+			delays_[measurement * 2 + ear] = minimumPhase.decompose(getIR(measurement, ear), out, numTaps);
+		}
+	}
+
+	// Drop the propagation delay common to all measurements, keeping the one sample
+	// FractionalDelay needs; only the differences between measurements matter.
+	const auto bulkDelay = *std::min_element(delays_.begin(), delays_.end()) - 1.f;
+	for (auto& delay : delays_)
+		delay -= bulkDelay;
+	maxDelay_ = *std::max_element(delays_.begin(), delays_.end());
+
+	// The measured IRs are no longer needed
+	ownedData_.swap(minimumPhaseData);
+	mappedFile_ = nullptr;
+	irData_ = ownedData_.data();
+	irLength_ = numTaps;
+	measurementStride_ = 2 * numTaps;
+	earStride_ = numTaps;
+}
+
+void HRTFDatabase::makeCompact()
+{
+	const auto numMeasurements = static_cast<int>(azimuths_.size() * elevations_.size());
+	std::vector<int16_t> compactData(numMeasurements * 2 * irLength_);
+	compactScales_.resize(numMeasurements * 2);
+
+	// Each IR gets its own scale, so quiet contralateral IRs keep their resolution
+	for (auto measurement = 0; measurement < numMeasurements; ++measurement)
+	{
+		for (auto ear = 0; ear < 2; ++ear)
+		{
+			auto* out = &compactData[(measurement * 2 + ear) * irLength_];
+			compactScales_[measurement * 2 + ear] = CompactStorage::quantise(getIR(measurement, ear), out, irLength_);
+		}
+	}
+
+	// The float IRs are no longer needed
+	compactData_.swap(compactData);
+	std::vector<float>().swap(ownedData_);
+	mappedFile_ = nullptr;
+	irData_ = nullptr;
+	measurementStride_ = 2 * irLength_;
+	earStride_ = irLength_;
+}
+
+bool HRTFDatabase::isOnKemarGrid() const
+{
+	if (azimuths_.size() != KemarGrid::numAzimuths || elevations_.size() != KemarGrid::numElevations)
+		return false;
+	for (auto i = 0; i < KemarGrid::numAzimuths; ++i)
+		if (azimuths_[i] != KemarGrid::azimuths[i])
+			return false;
+	for (auto i = 0; i < KemarGrid::numElevations; ++i)
+		if (elevations_[i] != KemarGrid::elevation(i))
+			return false;
+	return true;
+}
+
+void HRTFDatabase::buildTriangulation()
+{
+	std::vector<Triangle> triangles;
+
+	// The KEMAR grid is fixed, so its triangulation is baked at build time
+	// (see tools/BakeTriangulation.cpp); only other grids are triangulated here.
+	static_assert(KemarTriangulation::numVertices == KemarGrid::numVertices, "KemarTriangulation.h is out of date");
+	if (isOnKemarGrid())
+	{
+		for (auto face = 0; face < KemarTriangulation::numFaces; ++face)
+		{
+			const auto* v = KemarTriangulation::faceVertices[face];
+			triangles.push_back({{getVertex(v[0]), getVertex(v[1]), getVertex(v[2])}});
+		}
+		buildFaces(triangles, KemarTriangulation::faceInverseTransforms);
+		return;
+	}
+
+	const auto numMeasurements = static_cast<int>(azimuths_.size() * elevations_.size());
+	auto vertexAzimuth = [this](int v) { return getVertex(v).azimuth; };
+	auto vertexElevation = [this](int v) { return getVertex(v).elevation; };
+	for (auto& t : triangulate(numMeasurements, vertexAzimuth, vertexElevation))
+		triangles.push_back({{getVertex(t[0]), getVertex(t[1]), getVertex(t[2])}});
+	buildFaces(triangles, nullptr);
+}
+
+int HRTFDatabase::getIROffset(int measurement, int ear) const
+{
+	return measurement * measurementStride_ + ear * earStride_;
+}
+
+const float* HRTFDatabase::getIR(int measurement, int ear) const
+{
+	jassert(irData_ != nullptr);
+	return irData_ + getIROffset(measurement, ear);
+}
+
+void HRTFDatabase::copyIR(int measurement, int ear, float* dest, int length) const
+{
+	jassert(length <= irLength_);
+	const auto offset = getIROffset(measurement, ear);
+	if (isCompact())
+	{
+		const auto scale = compactScales_[measurement * 2 + ear];
+		for (auto i = 0; i < length; ++i)
+			dest[i] = scale * compactData_[offset + i];
+	}
+	else
+	{
+		std::copy(irData_ + offset, irData_ + offset + length, dest);
+	}
+}
+
+HRTFDatabase::Vertex HRTFDatabase::getVertex(int measurement) const
+{
+	const auto numElevations = static_cast<int>(elevations_.size());
+	return Vertex{azimuths_[measurement / numElevations], elevations_[measurement % numElevations], measurement};
+}
+
+std::vector<std::array<int, 3>> HRTFDatabase::triangulate(int numVertices,
+	std::function<double(int)> vertexAzimuth, std::function<double(int)> vertexElevation)
+{
+	std::vector<std::array<int, 3>> triangles;
+#ifdef TPP
+	std::vector<tpp::Delaunay::Point> points;
+	for (auto vertex = 0; vertex < numVertices; ++vertex)
+		points.push_back(tpp::Delaunay::Point(vertexAzimuth(vertex), vertexElevation(vertex)));
+
+	tpp::Delaunay triangulation(points);
+	triangulation.Triangulate();
+
+	for (auto fit = triangulation.fbegin(); fit != triangulation.fend(); ++fit)
+		triangles.push_back({{triangulation.Org(fit), triangulation.Dest(fit), triangulation.Apex(fit)}});
+#else
+	std::vector<Vec2f> points;
+	for (auto vertex = 0; vertex < numVertices; ++vertex)
+		points.push_back({static_cast<float>(vertexAzimuth(vertex)), static_cast<float>(vertexElevation(vertex))});
+
+	Delaunay triangulation;
+	triangulation.triangulate(points);
+
+	auto vertexIndex = [&points](const Vec2f& p)
+	{
+		return static_cast<int>(std::find(points.begin(), points.end(), p) - points.begin());
+	};
+	for (auto& triangle : triangulation.getTriangles())
+		triangles.push_back({{vertexIndex(triangle.p1), vertexIndex(triangle.p2), vertexIndex(triangle.p3)}});
+#endif
+	return triangles;
+}
+
+void HRTFDatabase::buildFaces(const std::vector<Triangle>& triangles, const double (*inverseTransforms)[4])
+{
+	gridAzimuth_ = azimuths_.front();
+	gridElevation_ = elevations_.front();
+	gridAzmCells_ = jmax(1, static_cast<int>(std::ceil((azimuths_.back() - gridAzimuth_) / GRID_CELL_SIZE)));
+	gridElvCells_ = jmax(1, static_cast<int>(std::ceil((elevations_.back() - gridElevation_) / GRID_CELL_SIZE)));
+	std::vector<std::vector<int>> cells(gridAzmCells_ * gridElvCells_);
+
+	for (auto& triangle : triangles)
+	{
+		const auto& A = triangle[0];
+		const auto& B = triangle[1];
+		const auto& C = triangle[2];
+
+		Face face;
+		face.measurement[0] = A.measurement;
+		face.measurement[1] = B.measurement;
+		face.measurement[2] = C.measurement;
+		face.originAzimuth = C.azimuth;
+		face.originElevation = C.elevation;
+
+		const auto faceIndex = static_cast<int>(faces_.size());
+		if (inverseTransforms != nullptr)
+		{
+			std::copy(inverseTransforms[faceIndex], inverseTransforms[faceIndex] + 4, face.invT);
+		}
+		else
+		{
+			const double T[] = {A.azimuth - C.azimuth, A.elevation - C.elevation,
+				B.azimuth - C.azimuth, B.elevation - C.elevation};
+			const auto det = T[0] * T[3] - T[1] * T[2];
+			jassert(det != 0 && "Bad triangulation!");
+			face.invT[0] = T[3] / det;
+			face.invT[1] = -T[1] / det;
+			face.invT[2] = -T[2] / det;
+			face.invT[3] = T[0] / det;
+		}
+
+		// Register the face with every cell its bounding box touches
+		faces_.push_back(face);
+
+		const auto cellMin = getCellIndex(jmin(A.azimuth, B.azimuth, C.azimuth), jmin(A.elevation, B.elevation, C.elevation));
+		const auto cellMax = getCellIndex(jmax(A.azimuth, B.azimuth, C.azimuth), jmax(A.elevation, B.elevation, C.elevation));
+		jassert(cellMin >= 0 && cellMax >= 0);
+		for (auto azm = cellMin / gridElvCells_; azm <= cellMax / gridElvCells_; ++azm)
+			for (auto elv = cellMin % gridElvCells_; elv <= cellMax % gridElvCells_; ++elv)
+				cells[azm * gridElvCells_ + elv].push_back(faceIndex);
+	}
+
+	// Flatten the cell lists so that a lookup touches two contiguous arrays
+	cellStart_.clear();
+	cellFaces_.clear();
+	for (auto& cell : cells)
+	{
+		cellStart_.push_back(static_cast<int>(cellFaces_.size()));
+		cellFaces_.insert(cellFaces_.end(), cell.begin(), cell.end());
+	}
+	cellStart_.push_back(static_cast<int>(cellFaces_.size()));
+}
+
+int HRTFDatabase::getCellIndex(double azimuth, double elevation) const
+{
+	const auto azm = static_cast<int>(std::floor((azimuth - gridAzimuth_) / GRID_CELL_SIZE));
+	const auto elv = static_cast<int>(std::floor((elevation - gridElevation_) / GRID_CELL_SIZE));
+	if (azimuth < gridAzimuth_ || elevation < gridElevation_ || azm > gridAzmCells_ || elv > gridElvCells_)
+		return -1;
+
+	// Points on the upper edges belong to the last row/column of cells
+	return jmin(azm, gridAzmCells_ - 1) * gridElvCells_ + jmin(elv, gridElvCells_ - 1);
+}
@@ -0,0 +1,258 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <vector>
+#include "../JuceLibraryCode/JuceHeader.h"
+#include "HRTFFileFormat.h"
+#include "Util.h"
+
+struct HRIRBuffer
+{
+	using ImpulseResponse = std::vector<float>;
+
+	void setSize(int irLength)
+	{
+		leftEarIR.assign(irLength, 0.f);
+		rightEarIR.assign(irLength, 0.f);
+	}
+
+	ImpulseResponse leftEarIR;
+	ImpulseResponse rightEarIR;
+	// Onset delay in samples still to be applied to each ear; zero unless the set is minimum phase
+	float leftEarDelay = 0.f;
+	float rightEarDelay = 0.f;
+};
+
+/** Frequency-domain counterpart of HRIRBuffer: the transfer functions of both ears
+	for one FFT size, in the format produced by OouraFFT::fft(). Each is split into
+	partitions as described at HRTFDatabase::Spectra.
+*/
+struct HRTFBuffer
+{
+	using TransferFunction = ComplexVector<float>;
+
+	void setSize(int tfSize)
+	{
+		leftEarTF.assign(tfSize, {});
+		rightEarTF.assign(tfSize, {});
+	}
+
+	TransferFunction leftEarTF;
+	TransferFunction rightEarTF;
+	// As in HRIRBuffer
+	float leftEarDelay = 0.f;
+	float rightEarDelay = 0.f;
+};
+
+/** Read-only set of measured HRIRs together with the triangulation of their positions.
+	The built-in KEMAR set comes from BinaryData; other sets are .hrtf files (see HRTFFileFormat.h)
+	that are memory mapped and used in place, so their IRs are only paged in when touched.
+	A set never changes after construction and is shared by every HRTFContainer that uses it;
+	get hold of one through a SharedResourcePointer<HRTFDatabase::Library>.
+	A set can also be loaded minimum phase: every IR is then split into a short
+	minimum-phase filter and a per-ear onset delay (see MinimumPhase.h), which are
+	interpolated separately and rendered with a FractionalDelay after the filter.
+	Either kind can be stored compactly as 16-bit integers, see LoadOptions.
+	All const methods may be called from any thread.
+*/
+class HRTFDatabase : public ReferenceCountedObject
+{
+public:
+	typedef ReferenceCountedObjectPtr<HRTFDatabase> Ptr;
+
+	/** How the measurements of a set are prepared when it is loaded. */
+	struct LoadOptions
+	{
+		LoadOptions() : minimumPhaseTaps(0), compactStorage(false) {}
+
+		// > 0 splits every IR into a minimum-phase filter truncated to this many taps
+		// and a per-ear onset delay; 0 keeps the measured IRs
+		int minimumPhaseTaps;
+		// Keeps the IRs as 16-bit integers, each scaled to its own peak, halving their memory.
+		// They are only expanded to float when interpolated or transformed.
+		bool compactStorage;
+
+		bool operator< (const LoadOptions& other) const
+		{
+			return std::tie(minimumPhaseTaps, compactStorage) < std::tie(other.minimumPhaseTaps, other.compactStorage);
+		}
+	};
+
+	/** Process-wide cache of loaded sets. Sets stay loaded while any SharedResourcePointer
+		to the library exists; the last one to go frees them.
+	*/
+	class Library
+	{
+	public:
+		Ptr getDefault(const LoadOptions& options = LoadOptions());
+		// Returns nullptr if the file can't be mapped or isn't a valid .hrtf file
+		Ptr getFromFile(const File& file, const LoadOptions& options = LoadOptions());
+
+	private:
+		CriticalSection lock_;
+		std::map<LoadOptions, Ptr> defaults_;
+		std::map<std::pair<String, LoadOptions>, Ptr> sets_;
+	};
+
+	/** Transfer functions of every measurement of a set for one FFT size.
+		Each IR is cut into partitions of fftSize / 2 samples, and each partition is zero
+		padded to fftSize and transformed, ready for HRIRFilter's partitioned convolution.
+		Since the FFT is linear, blending these is equivalent to transforming the
+		blended IR, so a position change needs no FFT at all.
+	*/
+	struct Spectra
+	{
+		int fftSize;
+		int numBins; // fftSize / 2 + 1
+		int numPartitions;
+		ComplexVector<float> data; // [measurement][ear][partition][bin]
+
+		// Complex values in the transfer function of one ear
+		int getTFSize() const { return numPartitions * numBins; }
+
+		const std::complex<float>* get(int measurement, int ear) const
+		{
+			return data.data() + (measurement * 2 + ear) * getTFSize();
+		}
+	};
+
+	/** IRs, or transfer functions, pre-interpolated on a regular azimuth/elevation grid
+		spanning the set. Trades memory for update cost: a lookup is a bilinear blend of
+		four precomputed rows, with no triangle search.
+	*/
+	struct LookupTable
+	{
+		double firstAzimuth, firstElevation;
+		double azimuthStep, elevationStep;
+		int numAzimuths, numElevations;
+		int rowSize; // floats per ear and grid point
+		std::vector<float> data; // [azimuth][elevation][ear][rowSize]
+		std::vector<float> delays; // [azimuth][elevation][ear], empty unless the set is minimum phase
+
+		size_t getMemorySize() const { return (data.size() + delays.size()) * sizeof(float); }
+
+		// Finds the four grid points around (azimuth, elevation) and their bilinear weights.
+		// Returns false if the point is outside the grid.
+		bool locate(double azimuth, double elevation, int (&points)[4], float (&weights)[4]) const;
+	};
+
+	~HRTFDatabase();
+
+	// Writes the barycentric interpolation of the three measurements surrounding
+	// (azimuth, elevation), given in interaural degrees, into result, which must
+	// already be sized to getIRLength().
+	// Returns false and leaves result untouched if the point is outside the triangulation.
+	bool interpolateHRIR(double azimuth, double elevation, HRIRBuffer& result) const;
+
+	// Same as interpolateHRIR(), but blends transfer functions taken from spectra, which must
+	// have come from getSpectra() on this set. result must be sized to spectra.getTFSize().
+	bool interpolateHRTF(double azimuth, double elevation, const Spectra& spectra, HRTFBuffer& result) const;
+
+	// Returns the transfer functions of all measurements, partitioned for fftSize.
+	// They are computed on first use and shared until the last holder lets go, so call this
+	// from prepareToPlay() rather than from the audio thread.
+	std::shared_ptr<const Spectra> getSpectra(int fftSize) const;
+
+	// Returns the IRs interpolated every azimuthStep by elevationStep degrees or, given spectra,
+	// the transfer functions from them. Cached and shared like getSpectra(), with the same caveat.
+	std::shared_ptr<const LookupTable> getLookupTable(double azimuthStep, double elevationStep,
+		const Spectra* spectra = nullptr) const;
+
+	// Bilinear equivalents of interpolateHRIR()/interpolateHRTF() on a table from getLookupTable()
+	// built without/with spectra.
+	bool lookupHRIR(double azimuth, double elevation, const LookupTable& table, HRIRBuffer& result) const;
+	bool lookupHRTF(double azimuth, double elevation, const LookupTable& table, HRTFBuffer& result) const;
+
+	int getIRLength() const { return irLength_; }
+	double getSampleRate() const { return sampleRate_; }
+	bool isMinimumPhase() const { return !delays_.empty(); }
+	// Largest onset delay any interpolated IR can have, in samples
+	float getMaxDelay() const { return maxDelay_; }
+
+private:
+	// Built-in KEMAR set
+	explicit HRTFDatabase(const LoadOptions& options);
+	// Maps an .hrtf file; check isValid() afterwards
+	HRTFDatabase(const File& file, const LoadOptions& options);
+	bool isValid() const { return !faces_.empty(); }
+	bool isCompact() const { return !compactData_.empty(); }
+
+	struct Vertex
+	{
+		double azimuth;
+		double elevation;
+		int measurement;
+	};
+
+	// A triangle of the triangulation, with the inverse of its barycentric
+	// transform precomputed so that a point test is two multiply-adds.
+	struct Face
+	{
+		int measurement[3];
+		double invT[4];
+		double originAzimuth; // vertex C
+		double originElevation;
+	};
+
+	// Uniform grid over the azimuth/elevation range covered by the measurements.
+	// Each cell lists the faces whose bounding box overlaps it, so a lookup
+	// only tests a handful of faces wherever the source is.
+	static const int GRID_CELL_SIZE = 5; // degrees
+
+	// Returns the face containing (azimuth, elevation) and the point's barycentric
+	// coordinates in it, or nullptr if the point is outside the triangulation
+	const Face* findFace(double azimuth, double elevation, float (&g)[3]) const;
+	void interpolateDelays(const Face& face, const float (&g)[3], float& left, float& right) const;
+
+	void loadKemar();
+	bool loadFile(const File& file);
+	void makeMinimumPhase(int numTaps);
+	void makeCompact();
+	bool isOnKemarGrid() const;
+	void buildTriangulation();
+	int getCellIndex(double azimuth, double elevation) const;
+	int getIROffset(int measurement, int ear) const;
+	// Float sets only
+	const float* getIR(int measurement, int ear) const;
+	// Expands the first length samples of an IR of either kind into dest
+	void copyIR(int measurement, int ear, float* dest, int length) const;
+	Vertex getVertex(int measurement) const;
+
+	using Triangle = std::array<Vertex, 3>;
+	// inverseTransforms may hold precomputed invT for each triangle, or be nullptr
+	void buildFaces(const std::vector<Triangle>& triangles, const double (*inverseTransforms)[4]);
+	// Runtime fallback for grids without a baked triangulation; returns vertex indices
+	static std::vector<std::array<int, 3>> triangulate(int numVertices,
+		std::function<double(int)> vertexAzimuth, std::function<double(int)> vertexElevation);
+
+	ScopedPointer<MemoryMappedFile> mappedFile_;
+	std::vector<float> ownedData_; // built-in or minimum-phase sets only
+	const float* irData_ = nullptr; // nullptr once compact
+	std::vector<int16_t> compactData_; // compact sets only, [measurement][ear][tap]
+	std::vector<float> compactScales_; // [measurement][ear]
+	int irLength_ = 0;
+	int measurementStride_ = 0; // floats between consecutive measurements of one ear
+	int earStride_ = 0; // floats between the left and right IR of one measurement
+	double sampleRate_ = 44100.;
+	std::vector<double> azimuths_;
+	std::vector<double> elevations_;
+	std::vector<float> delays_; // [measurement][ear], minimum-phase sets only
+	float maxDelay_ = 0.f;
+
+	std::vector<Face> faces_;
+	double gridAzimuth_ = 0., gridElevation_ = 0.; // lower corner of the grid
+	int gridAzmCells_ = 0, gridElvCells_ = 0;
+	std::vector<int> cellStart_; // faces of cell i are cellFaces_[cellStart_[i] .. cellStart_[i + 1])
+	std::vector<int> cellFaces_;
+
+	mutable CriticalSection cacheLock_;
+	mutable std::map<int, std::weak_ptr<const Spectra>> spectra_;
+	// keyed by resolution and FFT size, 0 for IR tables
+	mutable std::map<std::tuple<double, double, int>, std::weak_ptr<const LookupTable>> lookupTables_;
+
+	JUCE_DECLARE_NON_COPYABLE(HRTFDatabase)
+};
@@ -0,0 +1,33 @@
+#pragma once
+#include <cstdint>
+
+/** Header of an .hrtf file, the on-disk format for HRTF sets other than the built-in one.
+	All fields are little endian and the file is meant to be memory mapped and used in place.
+
+	The header is followed by numAzimuths floats (interaural azimuths in degrees, ascending)
+	and numElevations floats (interaural elevations in degrees, ascending). The float IRs of
+	every measurement, azimuth major, start headerSize bytes from the beginning of the file.
+
+	Fields may be appended to the header without changing the version, readers skip to
+	headerSize; the version is only bumped for incompatible changes.
+*/
+struct HRTFFileHeader
+{
+	enum EarLayout
+	{
+		kEarsPerMeasurement = 0, // [measurement][ear][tap]
+		kEarsPlanar = 1 // [ear][measurement][tap]
+	};
+
+	static const uint32_t CURRENT_VERSION = 1;
+
+	char magic[4]; // "HRTF"
+	uint32_t version;
+	uint32_t headerSize; // offset of the first IR sample, multiple of 16
+	float sampleRate;
+	uint32_t irLength; // taps per ear
+	uint32_t numEars; // must be 2
+	uint32_t earLayout;
+	uint32_t numAzimuths;
+	uint32_t numElevations;
+};
@@ -0,0 +1,27 @@
+#pragma once
+
+/** Measurement grid of the built-in KEMAR set (kemar.bin), in interaural degrees.
+	kemar.bin stores, for each azimuth in turn, the left and right HRIRs of every
+	elevation in order. Shared by HRTFDatabase and tools/BakeTriangulation.cpp.
+*/
+namespace KemarGrid
+{
+	const int azimuths[] = {-90, -80, -65, -55, -45, -40, -35, -30, -25, -20,
+		-15, -10, -5, 0, 5, 10, 15, 20, 25, 30, 35, 40, 45, 55, 65, 80, 90};
+	const int numAzimuths = static_cast<int>(sizeof(azimuths) / sizeof(azimuths[0]));
+	const int numElevations = 52;
+	const int numVertices = numAzimuths * numElevations;
+
+	// -90 deg, 50 elevations between -45 and 230.625 deg, 270 deg
+	inline double elevation(int index)
+	{
+		if (index == 0)
+			return -90.;
+		if (index == numElevations - 1)
+			return 270.;
+		return -45. + 5.625 * (index - 1);
+	}
+
+	inline double vertexAzimuth(int vertex) { return azimuths[vertex / numElevations]; }
+	inline double vertexElevation(int vertex) { return elevation(vertex % numElevations); }
+}
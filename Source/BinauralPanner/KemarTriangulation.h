@@ -0,0 +1,5370 @@
+/*
+    IMPORTANT! This file is auto-generated by tools/BakeTriangulation.cpp
+    from KemarGrid.h - do not edit it by hand.
+*/
+
+#pragma once
+
+namespace KemarTriangulation
+{
+	const int numVertices = 1404;
+	const int numFaces = 2674;
+
+	// Vertices A, B, C of each face, indexed as in KemarGrid
+	const short faceVertices[numFaces][3] =
+	{
+		{0, 1, 53},
+		{52, 0, 53},
+		{1, 2, 54},
+		{53, 1, 54},
+		{2, 3, 55},
+		{54, 2, 55},
+		{3, 4, 56},
+		{55, 3, 56},
+		{4, 5, 57},
+		{56, 4, 57},
+		{5, 6, 58},
+		{57, 5, 58},
+		{6, 7, 59},
+		{58, 6, 59},
+		{7, 8, 60},
+		{59, 7, 60},
+		{8, 9, 61},
+		{60, 8, 61},
+		{9, 10, 62},
+		{61, 9, 62},
+		{10, 11, 63},
+		{62, 10, 63},
+		{11, 12, 64},
+		{63, 11, 64},
+		{12, 13, 65},
+		{64, 12, 65},
+		{13, 14, 66},
+		{65, 13, 66},
+		{14, 15, 67},
+		{66, 14, 67},
+		{15, 16, 68},
+		{67, 15, 68},
+		{16, 17, 69},
+		{68, 16, 69},
+		{17, 18, 70},
+		{69, 17, 70},
+		{18, 19, 71},
+		{70, 18, 71},
+		{19, 20, 72},
+		{71, 19, 72},
+		{20, 21, 73},
+		{72, 20, 73},
+		{21, 22, 74},
+		{73, 21, 74},
+		{22, 23, 75},
+		{74, 22, 75},
+		{23, 24, 76},
+		{75, 23, 76},
+		{24, 25, 77},
+		{76, 24, 77},
+		{25, 26, 78},
+		{77, 25, 78},
+		{26, 27, 79},
+		{78, 26, 79},
+		{27, 28, 80},
+		{79, 27, 80},
+		{28, 29, 81},
+		{80, 28, 81},
+		{29, 30, 82},
+		{81, 29, 82},
+		{30, 31, 83},
+		{82, 30, 83},
+		{31, 32, 84},
+		{83, 31, 84},
+		{32, 33, 84},
+		{84, 33, 85},
+		{33, 34, 86},
+		{85, 33, 86},
+		{34, 35, 87},
+		{86, 34, 87},
+		{35, 36, 88},
+		{87, 35, 88},
+		{36, 37, 89},
+		{88, 36, 89},
+		{37, 38, 90},
+		{89, 37, 90},
+		{38, 39, 91},
+		{90, 38, 91},
+		{39, 40, 92},
+		{91, 39, 92},
+		{40, 41, 93},
+		{92, 40, 93},
+		{41, 42, 94},
+		{93, 41, 94},
+		{42, 43, 95},
+		{94, 42, 95},
+		{43, 44, 96},
+		{95, 43, 96},
+		{44, 45, 97},
+		{96, 44, 97},
+		{45, 46, 98},
+		{97, 45, 98},
+		{46, 47, 99},
+		{98, 46, 99},
+		{47, 48, 99},
+		{99, 48, 100},
+		{49, 50, 101},
+		{48, 49, 101},
+		{100, 48, 101},
+		{101, 50, 102},
+		{50, 51, 103},
+		{102, 50, 103},
+		{0, 52, 105},
+		{104, 0, 105},
+		{52, 53, 105},
+		{53, 54, 106},
+		{105, 53, 106},
+		{54, 55, 107},
+		{106, 54, 107},
+		{55, 56, 108},
+		{107, 55, 108},
+		{56, 57, 109},
+		{108, 56, 109},
+		{57, 58, 110},
+		{109, 57, 110},
+		{58, 59, 111},
+		{110, 58, 111},
+		{59, 60, 112},
+		{111, 59, 112},
+		{60, 61, 113},
+		{112, 60, 113},
+		{61, 62, 114},
+		{113, 61, 114},
+		{62, 63, 115},
+		{114, 62, 115},
+		{63, 64, 116},
+		{115, 63, 116},
+		{64, 65, 117},
+		{116, 64, 117},
+		{65, 66, 118},
+		{117, 65, 118},
+		{66, 67, 119},
+		{118, 66, 119},
+		{67, 68, 120},
+		{119, 67, 120},
+		{68, 69, 121},
+		{120, 68, 121},
+		{69, 70, 122},
+		{121, 69, 122},
+		{70, 71, 123},
+		{122, 70, 123},
+		{71, 72, 124},
+		{123, 71, 124},
+		{72, 73, 125},
+		{124, 72, 125},
+		{73, 74, 126},
+		{125, 73, 126},
+		{74, 75, 127},
+		{126, 74, 127},
+		{75, 76, 128},
+		{127, 75, 128},
+		{76, 77, 129},
+		{128, 76, 129},
+		{77, 78, 130},
+		{129, 77, 130},
+		{78, 79, 131},
+		{130, 78, 131},
+		{79, 80, 132},
+		{131, 79, 132},
+		{80, 81, 132},
+		{132, 81, 133},
+		{81, 82, 134},
+		{133, 81, 134},
+		{82, 83, 134},
+		{134, 83, 135},
+		{83, 84, 136},
+		{135, 83, 136},
+		{84, 85, 136},
+		{136, 85, 137},
+		{85, 86, 138},
+		{137, 85, 138},
+		{86, 87, 138},
+		{138, 87, 139},
+		{87, 88, 140},
+		{139, 87, 140},
+		{88, 89, 140},
+		{140, 89, 141},
+		{89, 90, 142},
+		{141, 89, 142},
+		{90, 91, 142},
+		{142, 91, 143},
+		{91, 92, 144},
+		{143, 91, 144},
+		{92, 93, 144},
+		{144, 93, 145},
+		{93, 94, 146},
+		{145, 93, 146},
+		{94, 95, 146},
+		{146, 95, 147},
+		{95, 96, 148},
+		{147, 95, 148},
+		{96, 97, 148},
+		{148, 97, 149},
+		{97, 98, 150},
+		{149, 97, 150},
+		{98, 99, 150},
+		{150, 99, 151},
+		{99, 100, 152},
+		{151, 99, 152},
+		{100, 101, 152},
+		{152, 101, 153},
+		{102, 103, 154},
+		{101, 102, 154},
+		{153, 101, 154},
+		{154, 103, 155},
+		{0, 104, 157},
+		{156, 0, 157},
+		{104, 105, 157},
+		{105, 106, 158},
+		{157, 105, 158},
+		{106, 107, 159},
+		{158, 106, 159},
+		{107, 108, 160},
+		{159, 107, 160},
+		{108, 109, 161},
+		{160, 108, 161},
+		{109, 110, 162},
+		{161, 109, 162},
+		{110, 111, 163},
+		{162, 110, 163},
+		{111, 112, 164},
+		{163, 111, 164},
+		{112, 113, 165},
+		{164, 112, 165},
+		{113, 114, 166},
+		{165, 113, 166},
+		{114, 115, 167},
+		{166, 114, 167},
+		{115, 116, 168},
+		{167, 115, 168},
+		{116, 117, 169},
+		{168, 116, 169},
+		{117, 118, 170},
+		{169, 117, 170},
+		{118, 119, 171},
+		{170, 118, 171},
+		{119, 120, 172},
+		{171, 119, 172},
+		{120, 121, 173},
+		{172, 120, 173},
+		{121, 122, 174},
+		{173, 121, 174},
+		{122, 123, 175},
+		{174, 122, 175},
+		{123, 124, 176},
+		{175, 123, 176},
+		{124, 125, 177},
+		{176, 124, 177},
+		{125, 126, 178},
+		{177, 125, 178},
+		{126, 127, 179},
+		{178, 126, 179},
+		{127, 128, 180},
+		{179, 127, 180},
+		{128, 129, 181},
+		{180, 128, 181},
+		{129, 130, 182},
+		{181, 129, 182},
+		{130, 131, 183},
+		{182, 130, 183},
+		{131, 132, 184},
+		{183, 131, 184},
+		{132, 133, 185},
+		{184, 132, 185},
+		{133, 134, 186},
+		{185, 133, 186},
+		{134, 135, 187},
+		{186, 134, 187},
+		{135, 136, 188},
+		{187, 135, 188},
+		{136, 137, 189},
+		{188, 136, 189},
+		{137, 138, 190},
+		{189, 137, 190},
+		{138, 139, 190},
+		{190, 139, 191},
+		{139, 140, 192},
+		{191, 139, 192},
+		{140, 141, 193},
+		{192, 140, 193},
+		{141, 142, 194},
+		{193, 141, 194},
+		{142, 143, 195},
+		{194, 142, 195},
+		{143, 144, 196},
+		{195, 143, 196},
+		{144, 145, 197},
+		{196, 144, 197},
+		{145, 146, 198},
+		{197, 145, 198},
+		{146, 147, 199},
+		{198, 146, 199},
+		{147, 148, 200},
+		{199, 147, 200},
+		{148, 149, 201},
+		{200, 148, 201},
+		{149, 150, 202},
+		{201, 149, 202},
+		{150, 151, 203},
+		{202, 150, 203},
+		{151, 152, 204},
+		{203, 151, 204},
+		{153, 154, 205},
+		{152, 153, 205},
+		{204, 152, 205},
+		{205, 154, 206},
+		{154, 155, 207},
+		{206, 154, 207},
+		{0, 156, 209},
+		{208, 0, 209},
+		{156, 157, 209},
+		{157, 158, 210},
+		{209, 157, 210},
+		{158, 159, 211},
+		{210, 158, 211},
+		{159, 160, 212},
+		{211, 159, 212},
+		{160, 161, 213},
+		{212, 160, 213},
+		{161, 162, 214},
+		{213, 161, 214},
+		{162, 163, 215},
+		{214, 162, 215},
+		{163, 164, 216},
+		{215, 163, 216},
+		{164, 165, 217},
+		{216, 164, 217},
+		{165, 166, 218},
+		{217, 165, 218},
+		{166, 167, 219},
+		{218, 166, 219},
+		{167, 168, 220},
+		{219, 167, 220},
+		{168, 169, 221},
+		{220, 168, 221},
+		{169, 170, 222},
+		{221, 169, 222},
+		{170, 171, 223},
+		{222, 170, 223},
+		{171, 172, 224},
+		{223, 171, 224},
+		{172, 173, 225},
+		{224, 172, 225},
+		{173, 174, 226},
+		{225, 173, 226},
+		{174, 175, 227},
+		{226, 174, 227},
+		{175, 176, 228},
+		{227, 175, 228},
+		{176, 177, 229},
+		{228, 176, 229},
+		{177, 178, 230},
+		{229, 177, 230},
+		{178, 179, 231},
+		{230, 178, 231},
+		{179, 180, 232},
+		{231, 179, 232},
+		{180, 181, 233},
+		{232, 180, 233},
+		{181, 182, 234},
+		{233, 181, 234},
+		{182, 183, 235},
+		{234, 182, 235},
+		{183, 184, 236},
+		{235, 183, 236},
+		{184, 185, 237},
+		{236, 184, 237},
+		{185, 186, 238},
+		{237, 185, 238},
+		{186, 187, 239},
+		{238, 186, 239},
+		{187, 188, 240},
+		{239, 187, 240},
+		{188, 189, 241},
+		{240, 188, 241},
+		{189, 190, 242},
+		{241, 189, 242},
+		{190, 191, 243},
+		{242, 190, 243},
+		{191, 192, 244},
+		{243, 191, 244},
+		{192, 193, 245},
+		{244, 192, 245},
+		{193, 194, 246},
+		{245, 193, 246},
+		{194, 195, 247},
+		{246, 194, 247},
+		{195, 196, 248},
+		{247, 195, 248},
+		{196, 197, 249},
+		{248, 196, 249},
+		{197, 198, 250},
+		{249, 197, 250},
+		{198, 199, 251},
+		{250, 198, 251},
+		{199, 200, 252},
+		{251, 199, 252},
+		{200, 201, 253},
+		{252, 200, 253},
+		{201, 202, 254},
+		{253, 201, 254},
+		{202, 203, 255},
+		{254, 202, 255},
+		{203, 204, 256},
+		{255, 203, 256},
+		{205, 206, 257},
+		{204, 205, 257},
+		{256, 204, 257},
+		{257, 206, 258},
+		{206, 207, 259},
+		{258, 206, 259},
+		{0, 208, 261},
+		{260, 0, 261},
+		{208, 209, 261},
+		{209, 210, 262},
+		{261, 209, 262},
+		{210, 211, 263},
+		{262, 210, 263},
+		{211, 212, 264},
+		{263, 211, 264},
+		{212, 213, 265},
+		{264, 212, 265},
+		{213, 214, 266},
+		{265, 213, 266},
+		{214, 215, 267},
+		{266, 214, 267},
+		{215, 216, 268},
+		{267, 215, 268},
+		{216, 217, 269},
+		{268, 216, 269},
+		{217, 218, 270},
+		{269, 217, 270},
+		{218, 219, 271},
+		{270, 218, 271},
+		{219, 220, 272},
+		{271, 219, 272},
+		{220, 221, 273},
+		{272, 220, 273},
+		{221, 222, 274},
+		{273, 221, 274},
+		{222, 223, 275},
+		{274, 222, 275},
+		{223, 224, 276},
+		{275, 223, 276},
+		{224, 225, 277},
+		{276, 224, 277},
+		{225, 226, 278},
+		{277, 225, 278},
+		{226, 227, 279},
+		{278, 226, 279},
+		{227, 228, 280},
+		{279, 227, 280},
+		{228, 229, 281},
+		{280, 228, 281},
+		{229, 230, 282},
+		{281, 229, 282},
+		{230, 231, 283},
+		{282, 230, 283},
+		{231, 232, 284},
+		{283, 231, 284},
+		{232, 233, 285},
+		{284, 232, 285},
+		{233, 234, 286},
+		{285, 233, 286},
+		{234, 235, 287},
+		{286, 234, 287},
+		{235, 236, 288},
+		{287, 235, 288},
+		{236, 237, 289},
+		{288, 236, 289},
+		{237, 238, 290},
+		{289, 237, 290},
+		{238, 239, 291},
+		{290, 238, 291},
+		{239, 240, 292},
+		{291, 239, 292},
+		{240, 241, 293},
+		{292, 240, 293},
+		{241, 242, 294},
+		{293, 241, 294},
+		{242, 243, 295},
+		{294, 242, 295},
+		{243, 244, 296},
+		{295, 243, 296},
+		{244, 245, 297},
+		{296, 244, 297},
+		{245, 246, 298},
+		{297, 245, 298},
+		{246, 247, 299},
+		{298, 246, 299},
+		{247, 248, 300},
+		{299, 247, 300},
+		{248, 249, 301},
+		{300, 248, 301},
+		{249, 250, 302},
+		{301, 249, 302},
+		{250, 251, 303},
+		{302, 250, 303},
+		{251, 252, 304},
+		{303, 251, 304},
+		{252, 253, 305},
+		{304, 252, 305},
+		{253, 254, 306},
+		{305, 253, 306},
+		{254, 255, 307},
+		{306, 254, 307},
+		{255, 256, 308},
+		{307, 255, 308},
+		{257, 258, 309},
+		{256, 257, 309},
+		{308, 256, 309},
+		{309, 258, 310},
+		{258, 259, 311},
+		{310, 258, 311},
+		{0, 260, 313},
+		{312, 0, 313},
+		{260, 261, 313},
+		{261, 262, 314},
+		{313, 261, 314},
+		{262, 263, 315},
+		{314, 262, 315},
+		{263, 264, 316},
+		{315, 263, 316},
+		{264, 265, 317},
+		{316, 264, 317},
+		{265, 266, 318},
+		{317, 265, 318},
+		{266, 267, 319},
+		{318, 266, 319},
+		{267, 268, 320},
+		{319, 267, 320},
+		{268, 269, 321},
+		{320, 268, 321},
+		{269, 270, 322},
+		{321, 269, 322},
+		{270, 271, 323},
+		{322, 270, 323},
+		{271, 272, 324},
+		{323, 271, 324},
+		{272, 273, 325},
+		{324, 272, 325},
+		{273, 274, 326},
+		{325, 273, 326},
+		{274, 275, 327},
+		{326, 274, 327},
+		{275, 276, 328},
+		{327, 275, 328},
+		{276, 277, 329},
+		{328, 276, 329},
+		{277, 278, 330},
+		{329, 277, 330},
+		{278, 279, 331},
+		{330, 278, 331},
+		{279, 280, 332},
+		{331, 279, 332},
+		{280, 281, 333},
+		{332, 280, 333},
+		{281, 282, 334},
+		{333, 281, 334},
+		{282, 283, 335},
+		{334, 282, 335},
+		{283, 284, 336},
+		{335, 283, 336},
+		{284, 285, 337},
+		{336, 284, 337},
+		{285, 286, 338},
+		{337, 285, 338},
+		{286, 287, 339},
+		{338, 286, 339},
+		{287, 288, 340},
+		{339, 287, 340},
+		{288, 289, 341},
+		{340, 288, 341},
+		{289, 290, 342},
+		{341, 289, 342},
+		{290, 291, 343},
+		{342, 290, 343},
+		{291, 292, 344},
+		{343, 291, 344},
+		{292, 293, 345},
+		{344, 292, 345},
+		{293, 294, 346},
+		{345, 293, 346},
+		{294, 295, 347},
+		{346, 294, 347},
+		{295, 296, 348},
+		{347, 295, 348},
+		{296, 297, 349},
+		{348, 296, 349},
+		{297, 298, 350},
+		{349, 297, 350},
+		{298, 299, 351},
+		{350, 298, 351},
+		{299, 300, 352},
+		{351, 299, 352},
+		{300, 301, 353},
+		{352, 300, 353},
+		{301, 302, 354},
+		{353, 301, 354},
+		{302, 303, 355},
+		{354, 302, 355},
+		{303, 304, 356},
+		{355, 303, 356},
+		{304, 305, 357},
+		{356, 304, 357},
+		{305, 306, 358},
+		{357, 305, 358},
+		{306, 307, 359},
+		{358, 306, 359},
+		{307, 308, 360},
+		{359, 307, 360},
+		{309, 310, 361},
+		{308, 309, 361},
+		{360, 308, 361},
+		{361, 310, 362},
+		{310, 311, 363},
+		{362, 310, 363},
+		{312, 313, 365},
+		{364, 312, 365},
+		{313, 314, 366},
+		{365, 313, 366},
+		{314, 315, 367},
+		{366, 314, 367},
+		{315, 316, 368},
+		{367, 315, 368},
+		{316, 317, 369},
+		{368, 316, 369},
+		{317, 318, 370},
+		{369, 317, 370},
+		{318, 319, 371},
+		{370, 318, 371},
+		{319, 320, 372},
+		{371, 319, 372},
+		{320, 321, 373},
+		{372, 320, 373},
+		{321, 322, 374},
+		{373, 321, 374},
+		{322, 323, 375},
+		{374, 322, 375},
+		{323, 324, 376},
+		{375, 323, 376},
+		{324, 325, 377},
+		{376, 324, 377},
+		{325, 326, 378},
+		{377, 325, 378},
+		{326, 327, 379},
+		{378, 326, 379},
+		{327, 328, 380},
+		{379, 327, 380},
+		{328, 329, 381},
+		{380, 328, 381},
+		{329, 330, 382},
+		{381, 329, 382},
+		{330, 331, 383},
+		{382, 330, 383},
+		{331, 332, 384},
+		{383, 331, 384},
+		{332, 333, 385},
+		{384, 332, 385},
+		{333, 334, 386},
+		{385, 333, 386},
+		{334, 335, 387},
+		{386, 334, 387},
+		{335, 336, 388},
+		{387, 335, 388},
+		{336, 337, 389},
+		{388, 336, 389},
+		{337, 338, 390},
+		{389, 337, 390},
+		{338, 339, 391},
+		{390, 338, 391},
+		{339, 340, 392},
+		{391, 339, 392},
+		{340, 341, 393},
+		{392, 340, 393},
+		{341, 342, 394},
+		{393, 341, 394},
+		{342, 343, 395},
+		{394, 342, 395},
+		{343, 344, 396},
+		{395, 343, 396},
+		{344, 345, 397},
+		{396, 344, 397},
+		{345, 346, 398},
+		{397, 345, 398},
+		{346, 347, 399},
+		{398, 346, 399},
+		{347, 348, 400},
+		{399, 347, 400},
+		{348, 349, 401},
+		{400, 348, 401},
+		{349, 350, 402},
+		{401, 349, 402},
+		{350, 351, 403},
+		{402, 350, 403},
+		{351, 352, 404},
+		{403, 351, 404},
+		{352, 353, 405},
+		{404, 352, 405},
+		{353, 354, 406},
+		{405, 353, 406},
+		{354, 355, 407},
+		{406, 354, 407},
+		{355, 356, 408},
+		{407, 355, 408},
+		{356, 357, 409},
+		{408, 356, 409},
+		{357, 358, 410},
+		{409, 357, 410},
+		{358, 359, 411},
+		{410, 358, 411},
+		{359, 360, 412},
+		{411, 359, 412},
+		{361, 362, 413},
+		{360, 361, 413},
+		{412, 360, 413},
+		{413, 362, 414},
+		{362, 363, 415},
+		{414, 362, 415},
+		{312, 364, 417},
+		{416, 312, 417},
+		{364, 365, 417},
+		{365, 366, 418},
+		{417, 365, 418},
+		{366, 367, 419},
+		{418, 366, 419},
+		{367, 368, 420},
+		{419, 367, 420},
+		{368, 369, 421},
+		{420, 368, 421},
+		{369, 370, 422},
+		{421, 369, 422},
+		{370, 371, 423},
+		{422, 370, 423},
+		{371, 372, 424},
+		{423, 371, 424},
+		{372, 373, 425},
+		{424, 372, 425},
+		{373, 374, 426},
+		{425, 373, 426},
+		{374, 375, 427},
+		{426, 374, 427},
+		{375, 376, 428},
+		{427, 375, 428},
+		{376, 377, 429},
+		{428, 376, 429},
+		{377, 378, 430},
+		{429, 377, 430},
+		{378, 379, 431},
+		{430, 378, 431},
+		{379, 380, 432},
+		{431, 379, 432},
+		{380, 381, 433},
+		{432, 380, 433},
+		{381, 382, 434},
+		{433, 381, 434},
+		{382, 383, 435},
+		{434, 382, 435},
+		{383, 384, 436},
+		{435, 383, 436},
+		{384, 385, 437},
+		{436, 384, 437},
+		{385, 386, 438},
+		{437, 385, 438},
+		{386, 387, 439},
+		{438, 386, 439},
+		{387, 388, 440},
+		{439, 387, 440},
+		{388, 389, 441},
+		{440, 388, 441},
+		{389, 390, 442},
+		{441, 389, 442},
+		{390, 391, 443},
+		{442, 390, 443},
+		{391, 392, 444},
+		{443, 391, 444},
+		{392, 393, 445},
+		{444, 392, 445},
+		{393, 394, 446},
+		{445, 393, 446},
+		{394, 395, 447},
+		{446, 394, 447},
+		{395, 396, 448},
+		{447, 395, 448},
+		{396, 397, 449},
+		{448, 396, 449},
+		{397, 398, 450},
+		{449, 397, 450},
+		{398, 399, 451},
+		{450, 398, 451},
+		{399, 400, 452},
+		{451, 399, 452},
+		{400, 401, 453},
+		{452, 400, 453},
+		{401, 402, 454},
+		{453, 401, 454},
+		{402, 403, 455},
+		{454, 402, 455},
+		{403, 404, 456},
+		{455, 403, 456},
+		{404, 405, 457},
+		{456, 404, 457},
+		{405, 406, 458},
+		{457, 405, 458},
+		{406, 407, 459},
+		{458, 406, 459},
+		{407, 408, 460},
+		{459, 407, 460},
+		{408, 409, 461},
+		{460, 408, 461},
+		{409, 410, 462},
+		{461, 409, 462},
+		{410, 411, 463},
+		{462, 410, 463},
+		{411, 412, 464},
+		{463, 411, 464},
+		{413, 414, 465},
+		{412, 413, 465},
+		{464, 412, 465},
+		{465, 414, 466},
+		{414, 415, 467},
+		{466, 414, 467},
+		{312, 416, 469},
+		{468, 312, 469},
+		{416, 417, 469},
+		{417, 418, 470},
+		{469, 417, 470},
+		{418, 419, 471},
+		{470, 418, 471},
+		{419, 420, 472},
+		{471, 419, 472},
+		{420, 421, 473},
+		{472, 420, 473},
+		{421, 422, 474},
+		{473, 421, 474},
+		{422, 423, 475},
+		{474, 422, 475},
+		{423, 424, 476},
+		{475, 423, 476},
+		{424, 425, 477},
+		{476, 424, 477},
+		{425, 426, 478},
+		{477, 425, 478},
+		{426, 427, 479},
+		{478, 426, 479},
+		{427, 428, 480},
+		{479, 427, 480},
+		{428, 429, 481},
+		{480, 428, 481},
+		{429, 430, 482},
+		{481, 429, 482},
+		{430, 431, 483},
+		{482, 430, 483},
+		{431, 432, 484},
+		{483, 431, 484},
+		{432, 433, 485},
+		{484, 432, 485},
+		{433, 434, 486},
+		{485, 433, 486},
+		{434, 435, 487},
+		{486, 434, 487},
+		{435, 436, 488},
+		{487, 435, 488},
+		{436, 437, 489},
+		{488, 436, 489},
+		{437, 438, 490},
+		{489, 437, 490},
+		{438, 439, 491},
+		{490, 438, 491},
+		{439, 440, 492},
+		{491, 439, 492},
+		{440, 441, 493},
+		{492, 440, 493},
+		{441, 442, 494},
+		{493, 441, 494},
+		{442, 443, 495},
+		{494, 442, 495},
+		{443, 444, 496},
+		{495, 443, 496},
+		{444, 445, 497},
+		{496, 444, 497},
+		{445, 446, 498},
+		{497, 445, 498},
+		{446, 447, 499},
+		{498, 446, 499},
+		{447, 448, 500},
+		{499, 447, 500},
+		{448, 449, 501},
+		{500, 448, 501},
+		{449, 450, 502},
+		{501, 449, 502},
+		{450, 451, 503},
+		{502, 450, 503},
+		{451, 452, 504},
+		{503, 451, 504},
+		{452, 453, 505},
+		{504, 452, 505},
+		{453, 454, 506},
+		{505, 453, 506},
+		{454, 455, 507},
+		{506, 454, 507},
+		{455, 456, 508},
+		{507, 455, 508},
+		{456, 457, 509},
+		{508, 456, 509},
+		{457, 458, 510},
+		{509, 457, 510},
+		{458, 459, 511},
+		{510, 458, 511},
+		{459, 460, 512},
+		{511, 459, 512},
+		{460, 461, 513},
+		{512, 460, 513},
+		{461, 462, 514},
+		{513, 461, 514},
+		{462, 463, 515},
+		{514, 462, 515},
+		{463, 464, 516},
+		{515, 463, 516},
+		{465, 466, 517},
+		{464, 465, 517},
+		{516, 464, 517},
+		{517, 466, 518},
+		{466, 467, 519},
+		{518, 466, 519},
+		{312, 468, 521},
+		{520, 312, 521},
+		{468, 469, 521},
+		{469, 470, 522},
+		{521, 469, 522},
+		{470, 471, 523},
+		{522, 470, 523},
+		{471, 472, 524},
+		{523, 471, 524},
+		{472, 473, 525},
+		{524, 472, 525},
+		{473, 474, 526},
+		{525, 473, 526},
+		{474, 475, 527},
+		{526, 474, 527},
+		{475, 476, 528},
+		{527, 475, 528},
+		{476, 477, 529},
+		{528, 476, 529},
+		{477, 478, 530},
+		{529, 477, 530},
+		{478, 479, 531},
+		{530, 478, 531},
+		{479, 480, 532},
+		{531, 479, 532},
+		{480, 481, 533},
+		{532, 480, 533},
+		{481, 482, 534},
+		{533, 481, 534},
+		{482, 483, 535},
+		{534, 482, 535},
+		{483, 484, 536},
+		{535, 483, 536},
+		{484, 485, 537},
+		{536, 484, 537},
+		{485, 486, 538},
+		{537, 485, 538},
+		{486, 487, 539},
+		{538, 486, 539},
+		{487, 488, 540},
+		{539, 487, 540},
+		{488, 489, 541},
+		{540, 488, 541},
+		{489, 490, 542},
+		{541, 489, 542},
+		{490, 491, 543},
+		{542, 490, 543},
+		{491, 492, 544},
+		{543, 491, 544},
+		{492, 493, 545},
+		{544, 492, 545},
+		{493, 494, 546},
+		{545, 493, 546},
+		{494, 495, 547},
+		{546, 494, 547},
+		{495, 496, 548},
+		{547, 495, 548},
+		{496, 497, 549},
+		{548, 496, 549},
+		{497, 498, 550},
+		{549, 497, 550},
+		{498, 499, 551},
+		{550, 498, 551},
+		{499, 500, 552},
+		{551, 499, 552},
+		{500, 501, 553},
+		{552, 500, 553},
+		{501, 502, 554},
+		{553, 501, 554},
+		{502, 503, 555},
+		{554, 502, 555},
+		{504, 505, 556},
+		{503, 504, 556},
+		{555, 503, 556},
+		{556, 505, 557},
+		{505, 506, 558},
+		{557, 505, 558},
+		{506, 507, 559},
+		{558, 506, 559},
+		{507, 508, 560},
+		{559, 507, 560},
+		{508, 509, 561},
+		{560, 508, 561},
+		{509, 510, 562},
+		{561, 509, 562},
+		{510, 511, 563},
+		{562, 510, 563},
+		{511, 512, 564},
+		{563, 511, 564},
+		{512, 513, 565},
+		{564, 512, 565},
+		{513, 514, 566},
+		{565, 513, 566},
+		{514, 515, 567},
+		{566, 514, 567},
+		{515, 516, 568},
+		{567, 515, 568},
+		{517, 518, 569},
+		{516, 517, 569},
+		{568, 516, 569},
+		{569, 518, 570},
+		{518, 519, 571},
+		{570, 518, 571},
+		{312, 520, 573},
+		{572, 312, 573},
+		{520, 521, 573},
+		{521, 522, 574},
+		{573, 521, 574},
+		{522, 523, 575},
+		{574, 522, 575},
+		{523, 524, 576},
+		{575, 523, 576},
+		{524, 525, 577},
+		{576, 524, 577},
+		{525, 526, 578},
+		{577, 525, 578},
+		{526, 527, 579},
+		{578, 526, 579},
+		{527, 528, 580},
+		{579, 527, 580},
+		{528, 529, 581},
+		{580, 528, 581},
+		{529, 530, 582},
+		{581, 529, 582},
+		{530, 531, 583},
+		{582, 530, 583},
+		{531, 532, 584},
+		{583, 531, 584},
+		{532, 533, 585},
+		{584, 532, 585},
+		{533, 534, 586},
+		{585, 533, 586},
+		{534, 535, 587},
+		{586, 534, 587},
+		{535, 536, 588},
+		{587, 535, 588},
+		{536, 537, 589},
+		{588, 536, 589},
+		{537, 538, 590},
+		{589, 537, 590},
+		{538, 539, 591},
+		{590, 538, 591},
+		{539, 540, 592},
+		{591, 539, 592},
+		{540, 541, 593},
+		{592, 540, 593},
+		{541, 542, 594},
+		{593, 541, 594},
+		{542, 543, 595},
+		{594, 542, 595},
+		{543, 544, 596},
+		{595, 543, 596},
+		{544, 545, 597},
+		{596, 544, 597},
+		{545, 546, 598},
+		{597, 545, 598},
+		{546, 547, 599},
+		{598, 546, 599},
+		{547, 548, 600},
+		{599, 547, 600},
+		{548, 549, 601},
+		{600, 548, 601},
+		{549, 550, 602},
+		{601, 549, 602},
+		{550, 551, 603},
+		{602, 550, 603},
+		{551, 552, 604},
+		{603, 551, 604},
+		{552, 553, 605},
+		{604, 552, 605},
+		{553, 554, 606},
+		{605, 553, 606},
+		{554, 555, 607},
+		{606, 554, 607},
+		{555, 556, 608},
+		{607, 555, 608},
+		{556, 557, 609},
+		{608, 556, 609},
+		{557, 558, 610},
+		{609, 557, 610},
+		{558, 559, 611},
+		{610, 558, 611},
+		{559, 560, 612},
+		{611, 559, 612},
+		{560, 561, 613},
+		{612, 560, 613},
+		{561, 562, 614},
+		{613, 561, 614},
+		{562, 563, 615},
+		{614, 562, 615},
+		{563, 564, 616},
+		{615, 563, 616},
+		{564, 565, 617},
+		{616, 564, 617},
+		{565, 566, 618},
+		{617, 565, 618},
+		{566, 567, 619},
+		{618, 566, 619},
+		{567, 568, 620},
+		{619, 567, 620},
+		{569, 570, 621},
+		{568, 569, 621},
+		{620, 568, 621},
+		{621, 570, 622},
+		{570, 571, 623},
+		{622, 570, 623},
+		{312, 572, 625},
+		{624, 312, 625},
+		{572, 573, 625},
+		{573, 574, 626},
+		{625, 573, 626},
+		{574, 575, 627},
+		{626, 574, 627},
+		{575, 576, 628},
+		{627, 575, 628},
+		{576, 577, 629},
+		{628, 576, 629},
+		{577, 578, 630},
+		{629, 577, 630},
+		{578, 579, 631},
+		{630, 578, 631},
+		{579, 580, 632},
+		{631, 579, 632},
+		{580, 581, 633},
+		{632, 580, 633},
+		{581, 582, 634},
+		{633, 581, 634},
+		{582, 583, 635},
+		{634, 582, 635},
+		{583, 584, 636},
+		{635, 583, 636},
+		{584, 585, 637},
+		{636, 584, 637},
+		{585, 586, 638},
+		{637, 585, 638},
+		{586, 587, 639},
+		{638, 586, 639},
+		{587, 588, 640},
+		{639, 587, 640},
+		{588, 589, 641},
+		{640, 588, 641},
+		{589, 590, 642},
+		{641, 589, 642},
+		{590, 591, 643},
+		{642, 590, 643},
+		{591, 592, 644},
+		{643, 591, 644},
+		{592, 593, 645},
+		{644, 592, 645},
+		{593, 594, 646},
+		{645, 593, 646},
+		{594, 595, 647},
+		{646, 594, 647},
+		{595, 596, 648},
+		{647, 595, 648},
+		{596, 597, 649},
+		{648, 596, 649},
+		{597, 598, 650},
+		{649, 597, 650},
+		{598, 599, 651},
+		{650, 598, 651},
+		{599, 600, 652},
+		{651, 599, 652},
+		{600, 601, 653},
+		{652, 600, 653},
+		{601, 602, 654},
+		{653, 601, 654},
+		{602, 603, 655},
+		{654, 602, 655},
+		{603, 604, 656},
+		{655, 603, 656},
+		{604, 605, 657},
+		{656, 604, 657},
+		{605, 606, 658},
+		{657, 605, 658},
+		{606, 607, 659},
+		{658, 606, 659},
+		{607, 608, 660},
+		{659, 607, 660},
+		{608, 609, 661},
+		{660, 608, 661},
+		{609, 610, 662},
+		{661, 609, 662},
+		{610, 611, 663},
+		{662, 610, 663},
+		{611, 612, 664},
+		{663, 611, 664},
+		{612, 613, 665},
+		{664, 612, 665},
+		{613, 614, 666},
+		{665, 613, 666},
+		{614, 615, 667},
+		{666, 614, 667},
+		{615, 616, 668},
+		{667, 615, 668},
+		{616, 617, 669},
+		{668, 616, 669},
+		{617, 618, 670},
+		{669, 617, 670},
+		{618, 619, 671},
+		{670, 618, 671},
+		{619, 620, 672},
+		{671, 619, 672},
+		{621, 622, 673},
+		{620, 621, 673},
+		{672, 620, 673},
+		{673, 622, 674},
+		{622, 623, 675},
+		{674, 622, 675},
+		{312, 624, 677},
+		{676, 312, 677},
+		{624, 625, 677},
+		{625, 626, 678},
+		{677, 625, 678},
+		{626, 627, 679},
+		{678, 626, 679},
+		{627, 628, 680},
+		{679, 627, 680},
+		{628, 629, 681},
+		{680, 628, 681},
+		{629, 630, 682},
+		{681, 629, 682},
+		{630, 631, 683},
+		{682, 630, 683},
+		{631, 632, 684},
+		{683, 631, 684},
+		{632, 633, 685},
+		{684, 632, 685},
+		{633, 634, 686},
+		{685, 633, 686},
+		{634, 635, 687},
+		{686, 634, 687},
+		{635, 636, 688},
+		{687, 635, 688},
+		{636, 637, 689},
+		{688, 636, 689},
+		{637, 638, 690},
+		{689, 637, 690},
+		{638, 639, 691},
+		{690, 638, 691},
+		{639, 640, 692},
+		{691, 639, 692},
+		{640, 641, 693},
+		{692, 640, 693},
+		{641, 642, 694},
+		{693, 641, 694},
+		{642, 643, 695},
+		{694, 642, 695},
+		{643, 644, 696},
+		{695, 643, 696},
+		{644, 645, 697},
+		{696, 644, 697},
+		{645, 646, 698},
+		{697, 645, 698},
+		{646, 647, 699},
+		{698, 646, 699},
+		{647, 648, 700},
+		{699, 647, 700},
+		{648, 649, 701},
+		{700, 648, 701},
+		{649, 650, 702},
+		{701, 649, 702},
+		{650, 651, 703},
+		{702, 650, 703},
+		{651, 652, 704},
+		{703, 651, 704},
+		{652, 653, 705},
+		{704, 652, 705},
+		{653, 654, 706},
+		{705, 653, 706},
+		{654, 655, 707},
+		{706, 654, 707},
+		{655, 656, 708},
+		{707, 655, 708},
+		{656, 657, 709},
+		{708, 656, 709},
+		{657, 658, 710},
+		{709, 657, 710},
+		{658, 659, 711},
+		{710, 658, 711},
+		{659, 660, 712},
+		{711, 659, 712},
+		{660, 661, 713},
+		{712, 660, 713},
+		{661, 662, 714},
+		{713, 661, 714},
+		{662, 663, 715},
+		{714, 662, 715},
+		{663, 664, 716},
+		{715, 663, 716},
+		{664, 665, 717},
+		{716, 664, 717},
+		{665, 666, 718},
+		{717, 665, 718},
+		{666, 667, 719},
+		{718, 666, 719},
+		{667, 668, 720},
+		{719, 667, 720},
+		{668, 669, 721},
+		{720, 668, 721},
+		{669, 670, 722},
+		{721, 669, 722},
+		{670, 671, 723},
+		{722, 670, 723},
+		{671, 672, 724},
+		{723, 671, 724},
+		{673, 674, 725},
+		{672, 673, 725},
+		{724, 672, 725},
+		{725, 674, 726},
+		{674, 675, 727},
+		{726, 674, 727},
+		{312, 676, 729},
+		{728, 312, 729},
+		{676, 677, 729},
+		{677, 678, 730},
+		{729, 677, 730},
+		{678, 679, 731},
+		{730, 678, 731},
+		{679, 680, 732},
+		{731, 679, 732},
+		{680, 681, 733},
+		{732, 680, 733},
+		{681, 682, 734},
+		{733, 681, 734},
+		{682, 683, 735},
+		{734, 682, 735},
+		{683, 684, 736},
+		{735, 683, 736},
+		{684, 685, 737},
+		{736, 684, 737},
+		{685, 686, 738},
+		{737, 685, 738},
+		{686, 687, 739},
+		{738, 686, 739},
+		{687, 688, 740},
+		{739, 687, 740},
+		{688, 689, 741},
+		{740, 688, 741},
+		{689, 690, 742},
+		{741, 689, 742},
+		{690, 691, 743},
+		{742, 690, 743},
+		{691, 692, 744},
+		{743, 691, 744},
+		{692, 693, 745},
+		{744, 692, 745},
+		{693, 694, 746},
+		{745, 693, 746},
+		{694, 695, 747},
+		{746, 694, 747},
+		{695, 696, 748},
+		{747, 695, 748},
+		{696, 697, 749},
+		{748, 696, 749},
+		{697, 698, 750},
+		{749, 697, 750},
+		{698, 699, 751},
+		{750, 698, 751},
+		{699, 700, 752},
+		{751, 699, 752},
+		{700, 701, 753},
+		{752, 700, 753},
+		{701, 702, 754},
+		{753, 701, 754},
+		{702, 703, 755},
+		{754, 702, 755},
+		{703, 704, 756},
+		{755, 703, 756},
+		{704, 705, 757},
+		{756, 704, 757},
+		{705, 706, 758},
+		{757, 705, 758},
+		{706, 707, 759},
+		{758, 706, 759},
+		{707, 708, 760},
+		{759, 707, 760},
+		{708, 709, 761},
+		{760, 708, 761},
+		{709, 710, 762},
+		{761, 709, 762},
+		{710, 711, 763},
+		{762, 710, 763},
+		{711, 712, 764},
+		{763, 711, 764},
+		{712, 713, 765},
+		{764, 712, 765},
+		{713, 714, 766},
+		{765, 713, 766},
+		{714, 715, 767},
+		{766, 714, 767},
+		{715, 716, 768},
+		{767, 715, 768},
+		{716, 717, 769},
+		{768, 716, 769},
+		{717, 718, 770},
+		{769, 717, 770},
+		{718, 719, 771},
+		{770, 718, 771},
+		{719, 720, 772},
+		{771, 719, 772},
+		{720, 721, 773},
+		{772, 720, 773},
+		{721, 722, 774},
+		{773, 721, 774},
+		{722, 723, 775},
+		{774, 722, 775},
+		{723, 724, 776},
+		{775, 723, 776},
+		{725, 726, 777},
+		{724, 725, 777},
+		{776, 724, 777},
+		{777, 726, 778},
+		{726, 727, 779},
+		{778, 726, 779},
+		{312, 728, 781},
+		{780, 312, 781},
+		{728, 729, 781},
+		{729, 730, 782},
+		{781, 729, 782},
+		{730, 731, 783},
+		{782, 730, 783},
+		{731, 732, 784},
+		{783, 731, 784},
+		{732, 733, 785},
+		{784, 732, 785},
+		{733, 734, 786},
+		{785, 733, 786},
+		{734, 735, 787},
+		{786, 734, 787},
+		{735, 736, 788},
+		{787, 735, 788},
+		{736, 737, 789},
+		{788, 736, 789},
+		{737, 738, 790},
+		{789, 737, 790},
+		{738, 739, 791},
+		{790, 738, 791},
+		{739, 740, 792},
+		{791, 739, 792},
+		{740, 741, 793},
+		{792, 740, 793},
+		{741, 742, 794},
+		{793, 741, 794},
+		{742, 743, 795},
+		{794, 742, 795},
+		{743, 744, 796},
+		{795, 743, 796},
+		{744, 745, 797},
+		{796, 744, 797},
+		{745, 746, 798},
+		{797, 745, 798},
+		{746, 747, 799},
+		{798, 746, 799},
+		{747, 748, 800},
+		{799, 747, 800},
+		{748, 749, 801},
+		{800, 748, 801},
+		{749, 750, 802},
+		{801, 749, 802},
+		{750, 751, 803},
+		{802, 750, 803},
+		{751, 752, 804},
+		{803, 751, 804},
+		{752, 753, 805},
+		{804, 752, 805},
+		{753, 754, 806},
+		{805, 753, 806},
+		{754, 755, 807},
+		{806, 754, 807},
+		{755, 756, 808},
+		{807, 755, 808},
+		{756, 757, 809},
+		{808, 756, 809},
+		{757, 758, 810},
+		{809, 757, 810},
+		{758, 759, 811},
+		{810, 758, 811},
+		{759, 760, 812},
+		{811, 759, 812},
+		{760, 761, 813},
+		{812, 760, 813},
+		{761, 762, 814},
+		{813, 761, 814},
+		{762, 763, 815},
+		{814, 762, 815},
+		{763, 764, 816},
+		{815, 763, 816},
+		{764, 765, 817},
+		{816, 764, 817},
+		{765, 766, 818},
+		{817, 765, 818},
+		{766, 767, 819},
+		{818, 766, 819},
+		{767, 768, 820},
+		{819, 767, 820},
+		{768, 769, 821},
+		{820, 768, 821},
+		{769, 770, 822},
+		{821, 769, 822},
+		{770, 771, 823},
+		{822, 770, 823},
+		{771, 772, 824},
+		{823, 771, 824},
+		{772, 773, 825},
+		{824, 772, 825},
+		{773, 774, 826},
+		{825, 773, 826},
+		{774, 775, 827},
+		{826, 774, 827},
+		{775, 776, 828},
+		{827, 775, 828},
+		{777, 778, 829},
+		{776, 777, 829},
+		{828, 776, 829},
+		{829, 778, 830},
+		{778, 779, 831},
+		{830, 778, 831},
+		{312, 780, 833},
+		{832, 312, 833},
+		{780, 781, 833},
+		{781, 782, 834},
+		{833, 781, 834},
+		{782, 783, 835},
+		{834, 782, 835},
+		{783, 784, 836},
+		{835, 783, 836},
+		{784, 785, 837},
+		{836, 784, 837},
+		{785, 786, 838},
+		{837, 785, 838},
+		{786, 787, 839},
+		{838, 786, 839},
+		{787, 788, 840},
+		{839, 787, 840},
+		{788, 789, 841},
+		{840, 788, 841},
+		{789, 790, 842},
+		{841, 789, 842},
+		{790, 791, 843},
+		{842, 790, 843},
+		{791, 792, 844},
+		{843, 791, 844},
+		{792, 793, 845},
+		{844, 792, 845},
+		{793, 794, 846},
+		{845, 793, 846},
+		{794, 795, 847},
+		{846, 794, 847},
+		{795, 796, 848},
+		{847, 795, 848},
+		{796, 797, 849},
+		{848, 796, 849},
+		{797, 798, 850},
+		{849, 797, 850},
+		{798, 799, 851},
+		{850, 798, 851},
+		{799, 800, 852},
+		{851, 799, 852},
+		{800, 801, 853},
+		{852, 800, 853},
+		{801, 802, 854},
+		{853, 801, 854},
+		{802, 803, 855},
+		{854, 802, 855},
+		{803, 804, 856},
+		{855, 803, 856},
+		{804, 805, 857},
+		{856, 804, 857},
+		{805, 806, 858},
+		{857, 805, 858},
+		{806, 807, 859},
+		{858, 806, 859},
+		{807, 808, 860},
+		{859, 807, 860},
+		{808, 809, 861},
+		{860, 808, 861},
+		{809, 810, 862},
+		{861, 809, 862},
+		{810, 811, 863},
+		{862, 810, 863},
+		{811, 812, 864},
+		{863, 811, 864},
+		{812, 813, 865},
+		{864, 812, 865},
+		{813, 814, 866},
+		{865, 813, 866},
+		{814, 815, 867},
+		{866, 814, 867},
+		{815, 816, 868},
+		{867, 815, 868},
+		{816, 817, 869},
+		{868, 816, 869},
+		{817, 818, 870},
+		{869, 817, 870},
+		{818, 819, 871},
+		{870, 818, 871},
+		{819, 820, 872},
+		{871, 819, 872},
+		{820, 821, 873},
+		{872, 820, 873},
+		{821, 822, 874},
+		{873, 821, 874},
+		{822, 823, 875},
+		{874, 822, 875},
+		{823, 824, 876},
+		{875, 823, 876},
+		{824, 825, 877},
+		{876, 824, 877},
+		{825, 826, 878},
+		{877, 825, 878},
+		{826, 827, 879},
+		{878, 826, 879},
+		{827, 828, 880},
+		{879, 827, 880},
+		{829, 830, 881},
+		{828, 829, 881},
+		{880, 828, 881},
+		{881, 830, 882},
+		{830, 831, 883},
+		{882, 830, 883},
+		{312, 832, 885},
+		{884, 312, 885},
+		{832, 833, 885},
+		{833, 834, 886},
+		{885, 833, 886},
+		{834, 835, 887},
+		{886, 834, 887},
+		{835, 836, 888},
+		{887, 835, 888},
+		{836, 837, 889},
+		{888, 836, 889},
+		{837, 838, 890},
+		{889, 837, 890},
+		{838, 839, 891},
+		{890, 838, 891},
+		{839, 840, 892},
+		{891, 839, 892},
+		{840, 841, 893},
+		{892, 840, 893},
+		{841, 842, 894},
+		{893, 841, 894},
+		{842, 843, 895},
+		{894, 842, 895},
+		{843, 844, 896},
+		{895, 843, 896},
+		{844, 845, 897},
+		{896, 844, 897},
+		{845, 846, 898},
+		{897, 845, 898},
+		{846, 847, 899},
+		{898, 846, 899},
+		{847, 848, 900},
+		{899, 847, 900},
+		{848, 849, 901},
+		{900, 848, 901},
+		{849, 850, 902},
+		{901, 849, 902},
+		{850, 851, 903},
+		{902, 850, 903},
+		{851, 852, 904},
+		{903, 851, 904},
+		{852, 853, 905},
+		{904, 852, 905},
+		{853, 854, 906},
+		{905, 853, 906},
+		{854, 855, 907},
+		{906, 854, 907},
+		{855, 856, 908},
+		{907, 855, 908},
+		{856, 857, 909},
+		{908, 856, 909},
+		{857, 858, 910},
+		{909, 857, 910},
+		{858, 859, 911},
+		{910, 858, 911},
+		{859, 860, 912},
+		{911, 859, 912},
+		{860, 861, 913},
+		{912, 860, 913},
+		{861, 862, 914},
+		{913, 861, 914},
+		{862, 863, 915},
+		{914, 862, 915},
+		{863, 864, 916},
+		{915, 863, 916},
+		{864, 865, 917},
+		{916, 864, 917},
+		{865, 866, 918},
+		{917, 865, 918},
+		{866, 867, 919},
+		{918, 866, 919},
+		{867, 868, 920},
+		{919, 867, 920},
+		{868, 869, 921},
+		{920, 868, 921},
+		{869, 870, 922},
+		{921, 869, 922},
+		{870, 871, 923},
+		{922, 870, 923},
+		{871, 872, 924},
+		{923, 871, 924},
+		{872, 873, 925},
+		{924, 872, 925},
+		{873, 874, 926},
+		{925, 873, 926},
+		{874, 875, 927},
+		{926, 874, 927},
+		{875, 876, 928},
+		{927, 875, 928},
+		{876, 877, 929},
+		{928, 876, 929},
+		{877, 878, 930},
+		{929, 877, 930},
+		{878, 879, 931},
+		{930, 878, 931},
+		{879, 880, 932},
+		{931, 879, 932},
+		{881, 882, 933},
+		{880, 881, 933},
+		{932, 880, 933},
+		{933, 882, 934},
+		{882, 883, 935},
+		{934, 882, 935},
+		{312, 884, 937},
+		{936, 312, 937},
+		{884, 885, 937},
+		{885, 886, 938},
+		{937, 885, 938},
+		{886, 887, 939},
+		{938, 886, 939},
+		{887, 888, 940},
+		{939, 887, 940},
+		{888, 889, 941},
+		{940, 888, 941},
+		{889, 890, 942},
+		{941, 889, 942},
+		{890, 891, 943},
+		{942, 890, 943},
+		{891, 892, 944},
+		{943, 891, 944},
+		{892, 893, 945},
+		{944, 892, 945},
+		{893, 894, 946},
+		{945, 893, 946},
+		{894, 895, 947},
+		{946, 894, 947},
+		{895, 896, 948},
+		{947, 895, 948},
+		{896, 897, 949},
+		{948, 896, 949},
+		{897, 898, 950},
+		{949, 897, 950},
+		{898, 899, 951},
+		{950, 898, 951},
+		{899, 900, 952},
+		{951, 899, 952},
+		{900, 901, 953},
+		{952, 900, 953},
+		{901, 902, 954},
+		{953, 901, 954},
+		{902, 903, 955},
+		{954, 902, 955},
+		{903, 904, 956},
+		{955, 903, 956},
+		{904, 905, 957},
+		{956, 904, 957},
+		{905, 906, 958},
+		{957, 905, 958},
+		{906, 907, 958},
+		{958, 907, 959},
+		{907, 908, 960},
+		{959, 907, 960},
+		{908, 909, 961},
+		{960, 908, 961},
+		{909, 910, 962},
+		{961, 909, 962},
+		{910, 911, 963},
+		{962, 910, 963},
+		{911, 912, 964},
+		{963, 911, 964},
+		{912, 913, 965},
+		{964, 912, 965},
+		{913, 914, 966},
+		{965, 913, 966},
+		{914, 915, 967},
+		{966, 914, 967},
+		{915, 916, 968},
+		{967, 915, 968},
+		{916, 917, 969},
+		{968, 916, 969},
+		{917, 918, 970},
+		{969, 917, 970},
+		{918, 919, 971},
+		{970, 918, 971},
+		{919, 920, 972},
+		{971, 919, 972},
+		{920, 921, 973},
+		{972, 920, 973},
+		{921, 922, 974},
+		{973, 921, 974},
+		{922, 923, 975},
+		{974, 922, 975},
+		{923, 924, 976},
+		{975, 923, 976},
+		{924, 925, 977},
+		{976, 924, 977},
+		{925, 926, 978},
+		{977, 925, 978},
+		{926, 927, 979},
+		{978, 926, 979},
+		{927, 928, 980},
+		{979, 927, 980},
+		{928, 929, 981},
+		{980, 928, 981},
+		{929, 930, 982},
+		{981, 929, 982},
+		{930, 931, 983},
+		{982, 930, 983},
+		{931, 932, 984},
+		{983, 931, 984},
+		{933, 934, 985},
+		{932, 933, 985},
+		{984, 932, 985},
+		{985, 934, 986},
+		{934, 935, 987},
+		{986, 934, 987},
+		{936, 937, 989},
+		{988, 936, 989},
+		{937, 938, 990},
+		{989, 937, 990},
+		{938, 939, 991},
+		{990, 938, 991},
+		{939, 940, 992},
+		{991, 939, 992},
+		{940, 941, 993},
+		{992, 940, 993},
+		{941, 942, 994},
+		{993, 941, 994},
+		{942, 943, 995},
+		{994, 942, 995},
+		{943, 944, 996},
+		{995, 943, 996},
+		{944, 945, 997},
+		{996, 944, 997},
+		{945, 946, 998},
+		{997, 945, 998},
+		{946, 947, 999},
+		{998, 946, 999},
+		{947, 948, 1000},
+		{999, 947, 1000},
+		{948, 949, 1001},
+		{1000, 948, 1001},
+		{949, 950, 1002},
+		{1001, 949, 1002},
+		{950, 951, 1003},
+		{1002, 950, 1003},
+		{951, 952, 1004},
+		{1003, 951, 1004},
+		{952, 953, 1005},
+		{1004, 952, 1005},
+		{953, 954, 1006},
+		{1005, 953, 1006},
+		{954, 955, 1007},
+		{1006, 954, 1007},
+		{955, 956, 1008},
+		{1007, 955, 1008},
+		{956, 957, 1009},
+		{1008, 956, 1009},
+		{957, 958, 1010},
+		{1009, 957, 1010},
+		{958, 959, 1011},
+		{1010, 958, 1011},
+		{959, 960, 1012},
+		{1011, 959, 1012},
+		{960, 961, 1013},
+		{1012, 960, 1013},
+		{961, 962, 1014},
+		{1013, 961, 1014},
+		{962, 963, 1015},
+		{1014, 962, 1015},
+		{963, 964, 1016},
+		{1015, 963, 1016},
+		{964, 965, 1017},
+		{1016, 964, 1017},
+		{965, 966, 1018},
+		{1017, 965, 1018},
+		{966, 967, 1019},
+		{1018, 966, 1019},
+		{967, 968, 1020},
+		{1019, 967, 1020},
+		{968, 969, 1021},
+		{1020, 968, 1021},
+		{969, 970, 1022},
+		{1021, 969, 1022},
+		{970, 971, 1023},
+		{1022, 970, 1023},
+		{971, 972, 1024},
+		{1023, 971, 1024},
+		{972, 973, 1025},
+		{1024, 972, 1025},
+		{973, 974, 1026},
+		{1025, 973, 1026},
+		{974, 975, 1027},
+		{1026, 974, 1027},
+		{975, 976, 1028},
+		{1027, 975, 1028},
+		{976, 977, 1029},
+		{1028, 976, 1029},
+		{977, 978, 1030},
+		{1029, 977, 1030},
+		{978, 979, 1031},
+		{1030, 978, 1031},
+		{979, 980, 1032},
+		{1031, 979, 1032},
+		{980, 981, 1033},
+		{1032, 980, 1033},
+		{981, 982, 1034},
+		{1033, 981, 1034},
+		{982, 983, 1035},
+		{1034, 982, 1035},
+		{983, 984, 1036},
+		{1035, 983, 1036},
+		{985, 986, 1037},
+		{984, 985, 1037},
+		{1036, 984, 1037},
+		{1037, 986, 1038},
+		{986, 987, 1039},
+		{1038, 986, 1039},
+		{936, 988, 1041},
+		{1040, 936, 1041},
+		{988, 989, 1041},
+		{989, 990, 1042},
+		{1041, 989, 1042},
+		{990, 991, 1043},
+		{1042, 990, 1043},
+		{991, 992, 1044},
+		{1043, 991, 1044},
+		{992, 993, 1045},
+		{1044, 992, 1045},
+		{993, 994, 1046},
+		{1045, 993, 1046},
+		{994, 995, 1047},
+		{1046, 994, 1047},
+		{995, 996, 1048},
+		{1047, 995, 1048},
+		{996, 997, 1049},
+		{1048, 996, 1049},
+		{997, 998, 1050},
+		{1049, 997, 1050},
+		{998, 999, 1051},
+		{1050, 998, 1051},
+		{999, 1000, 1052},
+		{1051, 999, 1052},
+		{1000, 1001, 1053},
+		{1052, 1000, 1053},
+		{1001, 1002, 1054},
+		{1053, 1001, 1054},
+		{1002, 1003, 1055},
+		{1054, 1002, 1055},
+		{1003, 1004, 1056},
+		{1055, 1003, 1056},
+		{1004, 1005, 1057},
+		{1056, 1004, 1057},
+		{1005, 1006, 1058},
+		{1057, 1005, 1058},
+		{1006, 1007, 1059},
+		{1058, 1006, 1059},
+		{1007, 1008, 1060},
+		{1059, 1007, 1060},
+		{1008, 1009, 1061},
+		{1060, 1008, 1061},
+		{1009, 1010, 1062},
+		{1061, 1009, 1062},
+		{1010, 1011, 1063},
+		{1062, 1010, 1063},
+		{1011, 1012, 1064},
+		{1063, 1011, 1064},
+		{1012, 1013, 1065},
+		{1064, 1012, 1065},
+		{1013, 1014, 1066},
+		{1065, 1013, 1066},
+		{1014, 1015, 1067},
+		{1066, 1014, 1067},
+		{1015, 1016, 1068},
+		{1067, 1015, 1068},
+		{1016, 1017, 1069},
+		{1068, 1016, 1069},
+		{1017, 1018, 1070},
+		{1069, 1017, 1070},
+		{1018, 1019, 1071},
+		{1070, 1018, 1071},
+		{1019, 1020, 1072},
+		{1071, 1019, 1072},
+		{1020, 1021, 1073},
+		{1072, 1020, 1073},
+		{1021, 1022, 1074},
+		{1073, 1021, 1074},
+		{1022, 1023, 1075},
+		{1074, 1022, 1075},
+		{1023, 1024, 1076},
+		{1075, 1023, 1076},
+		{1024, 1025, 1077},
+		{1076, 1024, 1077},
+		{1025, 1026, 1078},
+		{1077, 1025, 1078},
+		{1026, 1027, 1079},
+		{1078, 1026, 1079},
+		{1027, 1028, 1080},
+		{1079, 1027, 1080},
+		{1028, 1029, 1081},
+		{1080, 1028, 1081},
+		{1029, 1030, 1082},
+		{1081, 1029, 1082},
+		{1030, 1031, 1083},
+		{1082, 1030, 1083},
+		{1031, 1032, 1084},
+		{1083, 1031, 1084},
+		{1032, 1033, 1085},
+		{1084, 1032, 1085},
+		{1033, 1034, 1086},
+		{1085, 1033, 1086},
+		{1034, 1035, 1087},
+		{1086, 1034, 1087},
+		{1035, 1036, 1088},
+		{1087, 1035, 1088},
+		{1037, 1038, 1089},
+		{1036, 1037, 1089},
+		{1088, 1036, 1089},
+		{1089, 1038, 1090},
+		{1038, 1039, 1091},
+		{1090, 1038, 1091},
+		{936, 1040, 1093},
+		{1092, 936, 1093},
+		{1040, 1041, 1093},
+		{1041, 1042, 1094},
+		{1093, 1041, 1094},
+		{1042, 1043, 1095},
+		{1094, 1042, 1095},
+		{1043, 1044, 1096},
+		{1095, 1043, 1096},
+		{1044, 1045, 1097},
+		{1096, 1044, 1097},
+		{1045, 1046, 1098},
+		{1097, 1045, 1098},
+		{1046, 1047, 1099},
+		{1098, 1046, 1099},
+		{1047, 1048, 1100},
+		{1099, 1047, 1100},
+		{1048, 1049, 1101},
+		{1100, 1048, 1101},
+		{1049, 1050, 1102},
+		{1101, 1049, 1102},
+		{1050, 1051, 1103},
+		{1102, 1050, 1103},
+		{1051, 1052, 1104},
+		{1103, 1051, 1104},
+		{1052, 1053, 1105},
+		{1104, 1052, 1105},
+		{1053, 1054, 1106},
+		{1105, 1053, 1106},
+		{1054, 1055, 1107},
+		{1106, 1054, 1107},
+		{1055, 1056, 1108},
+		{1107, 1055, 1108},
+		{1056, 1057, 1109},
+		{1108, 1056, 1109},
+		{1057, 1058, 1110},
+		{1109, 1057, 1110},
+		{1058, 1059, 1111},
+		{1110, 1058, 1111},
+		{1059, 1060, 1112},
+		{1111, 1059, 1112},
+		{1060, 1061, 1113},
+		{1112, 1060, 1113},
+		{1061, 1062, 1114},
+		{1113, 1061, 1114},
+		{1062, 1063, 1115},
+		{1114, 1062, 1115},
+		{1063, 1064, 1116},
+		{1115, 1063, 1116},
+		{1064, 1065, 1117},
+		{1116, 1064, 1117},
+		{1065, 1066, 1118},
+		{1117, 1065, 1118},
+		{1066, 1067, 1119},
+		{1118, 1066, 1119},
+		{1067, 1068, 1120},
+		{1119, 1067, 1120},
+		{1068, 1069, 1121},
+		{1120, 1068, 1121},
+		{1069, 1070, 1122},
+		{1121, 1069, 1122},
+		{1070, 1071, 1123},
+		{1122, 1070, 1123},
+		{1071, 1072, 1124},
+		{1123, 1071, 1124},
+		{1072, 1073, 1125},
+		{1124, 1072, 1125},
+		{1073, 1074, 1126},
+		{1125, 1073, 1126},
+		{1074, 1075, 1127},
+		{1126, 1074, 1127},
+		{1075, 1076, 1128},
+		{1127, 1075, 1128},
+		{1076, 1077, 1129},
+		{1128, 1076, 1129},
+		{1077, 1078, 1130},
+		{1129, 1077, 1130},
+		{1078, 1079, 1131},
+		{1130, 1078, 1131},
+		{1079, 1080, 1132},
+		{1131, 1079, 1132},
+		{1080, 1081, 1133},
+		{1132, 1080, 1133},
+		{1081, 1082, 1134},
+		{1133, 1081, 1134},
+		{1082, 1083, 1135},
+		{1134, 1082, 1135},
+		{1083, 1084, 1136},
+		{1135, 1083, 1136},
+		{1084, 1085, 1137},
+		{1136, 1084, 1137},
+		{1085, 1086, 1138},
+		{1137, 1085, 1138},
+		{1086, 1087, 1139},
+		{1138, 1086, 1139},
+		{1087, 1088, 1140},
+		{1139, 1087, 1140},
+		{1089, 1090, 1141},
+		{1088, 1089, 1141},
+		{1140, 1088, 1141},
+		{1141, 1090, 1142},
+		{1090, 1091, 1143},
+		{1142, 1090, 1143},
+		{936, 1092, 1145},
+		{1144, 936, 1145},
+		{1092, 1093, 1145},
+		{1093, 1094, 1146},
+		{1145, 1093, 1146},
+		{1094, 1095, 1147},
+		{1146, 1094, 1147},
+		{1095, 1096, 1148},
+		{1147, 1095, 1148},
+		{1096, 1097, 1149},
+		{1148, 1096, 1149},
+		{1097, 1098, 1150},
+		{1149, 1097, 1150},
+		{1098, 1099, 1151},
+		{1150, 1098, 1151},
+		{1099, 1100, 1152},
+		{1151, 1099, 1152},
+		{1100, 1101, 1153},
+		{1152, 1100, 1153},
+		{1101, 1102, 1154},
+		{1153, 1101, 1154},
+		{1102, 1103, 1155},
+		{1154, 1102, 1155},
+		{1103, 1104, 1156},
+		{1155, 1103, 1156},
+		{1104, 1105, 1157},
+		{1156, 1104, 1157},
+		{1105, 1106, 1158},
+		{1157, 1105, 1158},
+		{1106, 1107, 1159},
+		{1158, 1106, 1159},
+		{1107, 1108, 1160},
+		{1159, 1107, 1160},
+		{1108, 1109, 1161},
+		{1160, 1108, 1161},
+		{1109, 1110, 1162},
+		{1161, 1109, 1162},
+		{1110, 1111, 1163},
+		{1162, 1110, 1163},
+		{1111, 1112, 1164},
+		{1163, 1111, 1164},
+		{1112, 1113, 1164},
+		{1164, 1113, 1165},
+		{1113, 1114, 1166},
+		{1165, 1113, 1166},
+		{1114, 1115, 1167},
+		{1166, 1114, 1167},
+		{1115, 1116, 1168},
+		{1167, 1115, 1168},
+		{1116, 1117, 1169},
+		{1168, 1116, 1169},
+		{1117, 1118, 1170},
+		{1169, 1117, 1170},
+		{1118, 1119, 1171},
+		{1170, 1118, 1171},
+		{1119, 1120, 1172},
+		{1171, 1119, 1172},
+		{1120, 1121, 1173},
+		{1172, 1120, 1173},
+		{1121, 1122, 1174},
+		{1173, 1121, 1174},
+		{1122, 1123, 1175},
+		{1174, 1122, 1175},
+		{1123, 1124, 1176},
+		{1175, 1123, 1176},
+		{1124, 1125, 1177},
+		{1176, 1124, 1177},
+		{1125, 1126, 1178},
+		{1177, 1125, 1178},
+		{1127, 1128, 1179},
+		{1126, 1127, 1179},
+		{1178, 1126, 1179},
+		{1179, 1128, 1180},
+		{1128, 1129, 1181},
+		{1180, 1128, 1181},
+		{1129, 1130, 1182},
+		{1181, 1129, 1182},
+		{1130, 1131, 1183},
+		{1182, 1130, 1183},
+		{1131, 1132, 1184},
+		{1183, 1131, 1184},
+		{1132, 1133, 1185},
+		{1184, 1132, 1185},
+		{1133, 1134, 1186},
+		{1185, 1133, 1186},
+		{1134, 1135, 1187},
+		{1186, 1134, 1187},
+		{1135, 1136, 1188},
+		{1187, 1135, 1188},
+		{1136, 1137, 1189},
+		{1188, 1136, 1189},
+		{1137, 1138, 1190},
+		{1189, 1137, 1190},
+		{1138, 1139, 1191},
+		{1190, 1138, 1191},
+		{1139, 1140, 1192},
+		{1191, 1139, 1192},
+		{1141, 1142, 1193},
+		{1140, 1141, 1193},
+		{1192, 1140, 1193},
+		{1193, 1142, 1194},
+		{1142, 1143, 1195},
+		{1194, 1142, 1195},
+		{936, 1144, 1197},
+		{1196, 936, 1197},
+		{1144, 1145, 1197},
+		{1145, 1146, 1198},
+		{1197, 1145, 1198},
+		{1146, 1147, 1199},
+		{1198, 1146, 1199},
+		{1147, 1148, 1200},
+		{1199, 1147, 1200},
+		{1148, 1149, 1201},
+		{1200, 1148, 1201},
+		{1149, 1150, 1202},
+		{1201, 1149, 1202},
+		{1150, 1151, 1203},
+		{1202, 1150, 1203},
+		{1151, 1152, 1204},
+		{1203, 1151, 1204},
+		{1152, 1153, 1205},
+		{1204, 1152, 1205},
+		{1153, 1154, 1206},
+		{1205, 1153, 1206},
+		{1154, 1155, 1207},
+		{1206, 1154, 1207},
+		{1155, 1156, 1208},
+		{1207, 1155, 1208},
+		{1156, 1157, 1209},
+		{1208, 1156, 1209},
+		{1157, 1158, 1210},
+		{1209, 1157, 1210},
+		{1158, 1159, 1211},
+		{1210, 1158, 1211},
+		{1159, 1160, 1212},
+		{1211, 1159, 1212},
+		{1160, 1161, 1213},
+		{1212, 1160, 1213},
+		{1161, 1162, 1214},
+		{1213, 1161, 1214},
+		{1162, 1163, 1215},
+		{1214, 1162, 1215},
+		{1163, 1164, 1216},
+		{1215, 1163, 1216},
+		{1164, 1165, 1217},
+		{1216, 1164, 1217},
+		{1165, 1166, 1218},
+		{1217, 1165, 1218},
+		{1166, 1167, 1219},
+		{1218, 1166, 1219},
+		{1167, 1168, 1220},
+		{1219, 1167, 1220},
+		{1168, 1169, 1221},
+		{1220, 1168, 1221},
+		{1169, 1170, 1222},
+		{1221, 1169, 1222},
+		{1170, 1171, 1223},
+		{1222, 1170, 1223},
+		{1171, 1172, 1224},
+		{1223, 1171, 1224},
+		{1172, 1173, 1225},
+		{1224, 1172, 1225},
+		{1173, 1174, 1226},
+		{1225, 1173, 1226},
+		{1174, 1175, 1227},
+		{1226, 1174, 1227},
+		{1175, 1176, 1228},
+		{1227, 1175, 1228},
+		{1176, 1177, 1229},
+		{1228, 1176, 1229},
+		{1177, 1178, 1230},
+		{1229, 1177, 1230},
+		{1178, 1179, 1231},
+		{1230, 1178, 1231},
+		{1179, 1180, 1232},
+		{1231, 1179, 1232},
+		{1180, 1181, 1233},
+		{1232, 1180, 1233},
+		{1181, 1182, 1234},
+		{1233, 1181, 1234},
+		{1182, 1183, 1235},
+		{1234, 1182, 1235},
+		{1183, 1184, 1236},
+		{1235, 1183, 1236},
+		{1184, 1185, 1237},
+		{1236, 1184, 1237},
+		{1185, 1186, 1238},
+		{1237, 1185, 1238},
+		{1186, 1187, 1239},
+		{1238, 1186, 1239},
+		{1187, 1188, 1240},
+		{1239, 1187, 1240},
+		{1188, 1189, 1241},
+		{1240, 1188, 1241},
+		{1189, 1190, 1242},
+		{1241, 1189, 1242},
+		{1190, 1191, 1243},
+		{1242, 1190, 1243},
+		{1191, 1192, 1244},
+		{1243, 1191, 1244},
+		{1193, 1194, 1245},
+		{1192, 1193, 1245},
+		{1244, 1192, 1245},
+		{1245, 1194, 1246},
+		{1194, 1195, 1247},
+		{1246, 1194, 1247},
+		{936, 1196, 1249},
+		{1248, 936, 1249},
+		{1196, 1197, 1249},
+		{1197, 1198, 1250},
+		{1249, 1197, 1250},
+		{1198, 1199, 1251},
+		{1250, 1198, 1251},
+		{1199, 1200, 1252},
+		{1251, 1199, 1252},
+		{1200, 1201, 1253},
+		{1252, 1200, 1253},
+		{1201, 1202, 1254},
+		{1253, 1201, 1254},
+		{1202, 1203, 1255},
+		{1254, 1202, 1255},
+		{1203, 1204, 1256},
+		{1255, 1203, 1256},
+		{1204, 1205, 1257},
+		{1256, 1204, 1257},
+		{1205, 1206, 1258},
+		{1257, 1205, 1258},
+		{1206, 1207, 1259},
+		{1258, 1206, 1259},
+		{1207, 1208, 1260},
+		{1259, 1207, 1260},
+		{1208, 1209, 1261},
+		{1260, 1208, 1261},
+		{1209, 1210, 1262},
+		{1261, 1209, 1262},
+		{1210, 1211, 1263},
+		{1262, 1210, 1263},
+		{1211, 1212, 1264},
+		{1263, 1211, 1264},
+		{1212, 1213, 1265},
+		{1264, 1212, 1265},
+		{1213, 1214, 1266},
+		{1265, 1213, 1266},
+		{1214, 1215, 1266},
+		{1266, 1215, 1267},
+		{1215, 1216, 1268},
+		{1267, 1215, 1268},
+		{1216, 1217, 1269},
+		{1268, 1216, 1269},
+		{1217, 1218, 1270},
+		{1269, 1217, 1270},
+		{1218, 1219, 1271},
+		{1270, 1218, 1271},
+		{1219, 1220, 1272},
+		{1271, 1219, 1272},
+		{1220, 1221, 1273},
+		{1272, 1220, 1273},
+		{1221, 1222, 1274},
+		{1273, 1221, 1274},
+		{1222, 1223, 1275},
+		{1274, 1222, 1275},
+		{1223, 1224, 1276},
+		{1275, 1223, 1276},
+		{1224, 1225, 1277},
+		{1276, 1224, 1277},
+		{1225, 1226, 1278},
+		{1277, 1225, 1278},
+		{1226, 1227, 1279},
+		{1278, 1226, 1279},
+		{1227, 1228, 1280},
+		{1279, 1227, 1280},
+		{1228, 1229, 1281},
+		{1280, 1228, 1281},
+		{1229, 1230, 1282},
+		{1281, 1229, 1282},
+		{1230, 1231, 1283},
+		{1282, 1230, 1283},
+		{1231, 1232, 1284},
+		{1283, 1231, 1284},
+		{1232, 1233, 1285},
+		{1284, 1232, 1285},
+		{1233, 1234, 1286},
+		{1285, 1233, 1286},
+		{1234, 1235, 1287},
+		{1286, 1234, 1287},
+		{1235, 1236, 1288},
+		{1287, 1235, 1288},
+		{1236, 1237, 1289},
+		{1288, 1236, 1289},
+		{1237, 1238, 1290},
+		{1289, 1237, 1290},
+		{1238, 1239, 1291},
+		{1290, 1238, 1291},
+		{1239, 1240, 1292},
+		{1291, 1239, 1292},
+		{1240, 1241, 1293},
+		{1292, 1240, 1293},
+		{1241, 1242, 1294},
+		{1293, 1241, 1294},
+		{1242, 1243, 1295},
+		{1294, 1242, 1295},
+		{1243, 1244, 1296},
+		{1295, 1243, 1296},
+		{1245, 1246, 1297},
+		{1244, 1245, 1297},
+		{1296, 1244, 1297},
+		{1297, 1246, 1298},
+		{1246, 1247, 1299},
+		{1298, 1246, 1299},
+		{1248, 1249, 1301},
+		{1300, 1248, 1301},
+		{1249, 1250, 1302},
+		{1301, 1249, 1302},
+		{1250, 1251, 1302},
+		{1302, 1251, 1303},
+		{1251, 1252, 1304},
+		{1303, 1251, 1304},
+		{1252, 1253, 1304},
+		{1304, 1253, 1305},
+		{1253, 1254, 1306},
+		{1305, 1253, 1306},
+		{1254, 1255, 1306},
+		{1306, 1255, 1307},
+		{1255, 1256, 1308},
+		{1307, 1255, 1308},
+		{1256, 1257, 1308},
+		{1308, 1257, 1309},
+		{1257, 1258, 1310},
+		{1309, 1257, 1310},
+		{1258, 1259, 1310},
+		{1310, 1259, 1311},
+		{1259, 1260, 1312},
+		{1311, 1259, 1312},
+		{1260, 1261, 1312},
+		{1312, 1261, 1313},
+		{1261, 1262, 1314},
+		{1313, 1261, 1314},
+		{1262, 1263, 1314},
+		{1314, 1263, 1315},
+		{1263, 1264, 1316},
+		{1315, 1263, 1316},
+		{1264, 1265, 1316},
+		{1316, 1265, 1317},
+		{1265, 1266, 1318},
+		{1317, 1265, 1318},
+		{1266, 1267, 1319},
+		{1318, 1266, 1319},
+		{1267, 1268, 1320},
+		{1319, 1267, 1320},
+		{1268, 1269, 1321},
+		{1320, 1268, 1321},
+		{1269, 1270, 1322},
+		{1321, 1269, 1322},
+		{1270, 1271, 1323},
+		{1322, 1270, 1323},
+		{1271, 1272, 1324},
+		{1323, 1271, 1324},
+		{1272, 1273, 1325},
+		{1324, 1272, 1325},
+		{1273, 1274, 1326},
+		{1325, 1273, 1326},
+		{1274, 1275, 1327},
+		{1326, 1274, 1327},
+		{1275, 1276, 1328},
+		{1327, 1275, 1328},
+		{1276, 1277, 1329},
+		{1328, 1276, 1329},
+		{1277, 1278, 1330},
+		{1329, 1277, 1330},
+		{1278, 1279, 1330},
+		{1330, 1279, 1331},
+		{1279, 1280, 1332},
+		{1331, 1279, 1332},
+		{1280, 1281, 1332},
+		{1332, 1281, 1333},
+		{1281, 1282, 1334},
+		{1333, 1281, 1334},
+		{1282, 1283, 1334},
+		{1334, 1283, 1335},
+		{1283, 1284, 1336},
+		{1335, 1283, 1336},
+		{1284, 1285, 1336},
+		{1336, 1285, 1337},
+		{1285, 1286, 1338},
+		{1337, 1285, 1338},
+		{1286, 1287, 1338},
+		{1338, 1287, 1339},
+		{1287, 1288, 1340},
+		{1339, 1287, 1340},
+		{1288, 1289, 1340},
+		{1340, 1289, 1341},
+		{1289, 1290, 1342},
+		{1341, 1289, 1342},
+		{1290, 1291, 1342},
+		{1342, 1291, 1343},
+		{1291, 1292, 1344},
+		{1343, 1291, 1344},
+		{1292, 1293, 1344},
+		{1344, 1293, 1345},
+		{1293, 1294, 1346},
+		{1345, 1293, 1346},
+		{1294, 1295, 1346},
+		{1346, 1295, 1347},
+		{1295, 1296, 1348},
+		{1347, 1295, 1348},
+		{1296, 1297, 1348},
+		{1348, 1297, 1349},
+		{1297, 1298, 1350},
+		{1349, 1297, 1350},
+		{1298, 1299, 1351},
+		{1350, 1298, 1351},
+		{1248, 1300, 1353},
+		{1352, 1248, 1353},
+		{1300, 1301, 1353},
+		{1301, 1302, 1354},
+		{1353, 1301, 1354},
+		{1302, 1303, 1355},
+		{1354, 1302, 1355},
+		{1303, 1304, 1356},
+		{1355, 1303, 1356},
+		{1304, 1305, 1357},
+		{1356, 1304, 1357},
+		{1305, 1306, 1358},
+		{1357, 1305, 1358},
+		{1306, 1307, 1359},
+		{1358, 1306, 1359},
+		{1307, 1308, 1360},
+		{1359, 1307, 1360},
+		{1308, 1309, 1361},
+		{1360, 1308, 1361},
+		{1309, 1310, 1362},
+		{1361, 1309, 1362},
+		{1310, 1311, 1363},
+		{1362, 1310, 1363},
+		{1311, 1312, 1364},
+		{1363, 1311, 1364},
+		{1312, 1313, 1365},
+		{1364, 1312, 1365},
+		{1313, 1314, 1366},
+		{1365, 1313, 1366},
+		{1314, 1315, 1367},
+		{1366, 1314, 1367},
+		{1315, 1316, 1368},
+		{1367, 1315, 1368},
+		{1316, 1317, 1369},
+		{1368, 1316, 1369},
+		{1317, 1318, 1370},
+		{1369, 1317, 1370},
+		{1318, 1319, 1371},
+		{1370, 1318, 1371},
+		{1319, 1320, 1372},
+		{1371, 1319, 1372},
+		{1320, 1321, 1373},
+		{1372, 1320, 1373},
+		{1321, 1322, 1374},
+		{1373, 1321, 1374},
+		{1322, 1323, 1375},
+		{1374, 1322, 1375},
+		{1323, 1324, 1376},
+		{1375, 1323, 1376},
+		{1324, 1325, 1377},
+		{1376, 1324, 1377},
+		{1325, 1326, 1378},
+		{1377, 1325, 1378},
+		{1326, 1327, 1379},
+		{1378, 1326, 1379},
+		{1327, 1328, 1380},
+		{1379, 1327, 1380},
+		{1328, 1329, 1381},
+		{1380, 1328, 1381},
+		{1329, 1330, 1382},
+		{1381, 1329, 1382},
+		{1330, 1331, 1383},
+		{1382, 1330, 1383},
+		{1331, 1332, 1383},
+		{1383, 1332, 1384},
+		{1332, 1333, 1385},
+		{1384, 1332, 1385},
+		{1333, 1334, 1386},
+		{1385, 1333, 1386},
+		{1334, 1335, 1387},
+		{1386, 1334, 1387},
+		{1335, 1336, 1388},
+		{1387, 1335, 1388},
+		{1336, 1337, 1389},
+		{1388, 1336, 1389},
+		{1337, 1338, 1390},
+		{1389, 1337, 1390},
+		{1338, 1339, 1391},
+		{1390, 1338, 1391},
+		{1339, 1340, 1392},
+		{1391, 1339, 1392},
+		{1340, 1341, 1393},
+		{1392, 1340, 1393},
+		{1341, 1342, 1394},
+		{1393, 1341, 1394},
+		{1342, 1343, 1395},
+		{1394, 1342, 1395},
+		{1343, 1344, 1396},
+		{1395, 1343, 1396},
+		{1344, 1345, 1397},
+		{1396, 1344, 1397},
+		{1345, 1346, 1398},
+		{1397, 1345, 1398},
+		{1346, 1347, 1399},
+		{1398, 1346, 1399},
+		{1347, 1348, 1399},
+		{1399, 1348, 1400},
+		{1349, 1350, 1401},
+		{1348, 1349, 1401},
+		{1400, 1348, 1401},
+		{1401, 1350, 1402},
+		{1350, 1351, 1403},
+		{1402, 1350, 1403},
+	};
+
+	// Inverse of [A - C, B - C] for each face, column major
+	const double faceInverseTransforms[numFaces][4] =
+	{
+		{-0, -0.10000000000000001, -0.022222222222222223, 0.022222222222222223},
+		{0.10000000000000001, -0.10000000000000001, -0.022222222222222223, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0.10000000000000001, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0.10000000000000001, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0.10000000000000001, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.025396825396825397, 0.025396825396825397},
+		{0.10000000000000001, -0.10000000000000001, -0.025396825396825397, -0},
+		{-0.10000000000000001, 0.10000000000000001, 0.033333333333333333, -0.055555555555555552},
+		{0.040000000000000001, -0.040000000000000001, -0.022222222222222223, -0},
+		{-0, -0.066666666666666666, -0.022222222222222223, 0.022222222222222223},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0.066666666666666666, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0.066666666666666666, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0.066666666666666666, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0.066666666666666666, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0.066666666666666666, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0.066666666666666666, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0.066666666666666666, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0.066666666666666666, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0.066666666666666666, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0.066666666666666666, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0.066666666666666666, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0.066666666666666666, 0, -0.025396825396825397, 0.025396825396825397},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.025396825396825397, -0},
+		{-0.040000000000000001, 0.040000000000000001, 0.0088888888888888889, -0.03111111111111111},
+		{0.028571428571428571, -0.028571428571428571, -0.022222222222222223, -0},
+		{-0, -0.10000000000000001, -0.022222222222222223, 0.022222222222222223},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0.10000000000000001, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0.10000000000000001, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.025396825396825397, 0.025396825396825397},
+		{0.10000000000000001, -0.10000000000000001, -0.025396825396825397, -0},
+		{-0.028571428571428571, 0.028571428571428571, 0.0063492063492063492, -0.028571428571428571},
+		{0.022222222222222223, -0.022222222222222223, -0.022222222222222223, -0},
+		{-0, -0.10000000000000001, -0.022222222222222223, 0.022222222222222223},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0.10000000000000001, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.025396825396825397, 0.025396825396825397},
+		{0.10000000000000001, -0.10000000000000001, -0.025396825396825397, -0},
+		{-0.022222222222222223, 0.022222222222222223, 0.0024691358024691358, -0.024691358024691357},
+		{0.02, -0.02, -0.022222222222222223, -0},
+		{-0, -0.20000000000000001, -0.022222222222222223, 0.022222222222222223},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0.20000000000000001, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.025396825396825397, 0.025396825396825397},
+		{0.20000000000000001, -0.20000000000000001, -0.025396825396825397, -0},
+		{-0.02, 0.02, 0.0022222222222222222, -0.024444444444444446},
+		{0.018181818181818181, -0.018181818181818181, -0.022222222222222223, -0},
+		{-0, -0.20000000000000001, -0.022222222222222223, 0.022222222222222223},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0.20000000000000001, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.025396825396825397, 0.025396825396825397},
+		{0.20000000000000001, -0.20000000000000001, -0.025396825396825397, -0},
+		{-0, -0.20000000000000001, -0.022222222222222223, 0.022222222222222223},
+		{0.20000000000000001, -0.20000000000000001, -0.022222222222222223, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0.20000000000000001, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.025396825396825397, 0.025396825396825397},
+		{0.20000000000000001, -0.20000000000000001, -0.025396825396825397, -0},
+		{-0.20000000000000001, 0.20000000000000001, 0.022222222222222223, -0.044444444444444446},
+		{0.10000000000000001, -0.10000000000000001, -0.022222222222222223, -0},
+		{-0, -0.20000000000000001, -0.022222222222222223, 0.022222222222222223},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0.20000000000000001, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.025396825396825397, 0.025396825396825397},
+		{0.20000000000000001, -0.20000000000000001, -0.025396825396825397, -0},
+		{-0.10000000000000001, 0.10000000000000001, 0.011111111111111112, -0.033333333333333333},
+		{0.066666666666666666, -0.066666666666666666, -0.022222222222222223, -0},
+		{-0, -0.20000000000000001, -0.022222222222222223, 0.022222222222222223},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0.20000000000000001, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.025396825396825397, 0.025396825396825397},
+		{0.20000000000000001, -0.20000000000000001, -0.025396825396825397, -0},
+		{-0.066666666666666666, 0.066666666666666666, 0.0074074074074074077, -0.029629629629629631},
+		{0.050000000000000003, -0.050000000000000003, -0.022222222222222223, -0},
+		{-0, -0.20000000000000001, -0.022222222222222223, 0.022222222222222223},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0.20000000000000001, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0.20000000000000001, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.025396825396825397, 0.025396825396825397},
+		{0.20000000000000001, -0.20000000000000001, -0.025396825396825397, -0},
+		{-0.050000000000000003, 0.050000000000000003, 0.0055555555555555558, -0.027777777777777776},
+		{0.040000000000000001, -0.040000000000000001, -0.022222222222222223, -0},
+		{-0, -0.20000000000000001, -0.022222222222222223, 0.022222222222222223},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0.20000000000000001, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.025396825396825397, 0.025396825396825397},
+		{0.20000000000000001, -0.20000000000000001, -0.025396825396825397, -0},
+		{-0.040000000000000001, 0.040000000000000001, 0.0044444444444444444, -0.026666666666666668},
+		{0.033333333333333333, -0.033333333333333333, -0.022222222222222223, -0},
+		{-0, -0.20000000000000001, -0.022222222222222223, 0.022222222222222223},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0.20000000000000001, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.025396825396825397, 0.025396825396825397},
+		{0.20000000000000001, -0.20000000000000001, -0.025396825396825397, -0},
+		{-0.033333333333333333, 0.033333333333333333, 0.0037037037037037038, -0.025925925925925925},
+		{0.028571428571428571, -0.028571428571428571, -0.022222222222222223, -0},
+		{-0, -0.20000000000000001, -0.022222222222222223, 0.022222222222222223},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0.20000000000000001, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.025396825396825397, 0.025396825396825397},
+		{0.20000000000000001, -0.20000000000000001, -0.025396825396825397, -0},
+		{-0.028571428571428571, 0.028571428571428571, 0.0031746031746031746, -0.025396825396825397},
+		{0.025000000000000001, -0.025000000000000001, -0.022222222222222223, -0},
+		{-0, -0.20000000000000001, -0.022222222222222223, 0.022222222222222223},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0.20000000000000001, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.025396825396825397, 0.025396825396825397},
+		{0.20000000000000001, -0.20000000000000001, -0.025396825396825397, -0},
+		{-0.025000000000000001, 0.025000000000000001, 0.0027777777777777779, -0.025000000000000001},
+		{0.022222222222222223, -0.022222222222222223, -0.022222222222222223, -0},
+		{-0, -0.20000000000000001, -0.022222222222222223, 0.022222222222222223},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0.20000000000000001, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.025396825396825397, 0.025396825396825397},
+		{0.20000000000000001, -0.20000000000000001, -0.025396825396825397, -0},
+		{-0.022222222222222223, 0.022222222222222223, 0.0024691358024691358, -0.024691358024691357},
+		{0.02, -0.02, -0.022222222222222223, -0},
+		{-0, -0.20000000000000001, -0.022222222222222223, 0.022222222222222223},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0.20000000000000001, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.025396825396825397, 0.025396825396825397},
+		{0.20000000000000001, -0.20000000000000001, -0.025396825396825397, -0},
+		{-0.02, 0.02, 0.0022222222222222222, -0.024444444444444446},
+		{0.018181818181818181, -0.018181818181818181, -0.022222222222222223, -0},
+		{-0, -0.20000000000000001, -0.022222222222222223, 0.022222222222222223},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0.20000000000000001, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.025396825396825397, 0.025396825396825397},
+		{0.20000000000000001, -0.20000000000000001, -0.025396825396825397, -0},
+		{-0.018181818181818181, 0.018181818181818181, 0.0020202020202020202, -0.024242424242424242},
+		{0.016666666666666666, -0.016666666666666666, -0.022222222222222223, -0},
+		{-0, -0.20000000000000001, -0.022222222222222223, 0.022222222222222223},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0.20000000000000001, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0.20000000000000001, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.025396825396825397, 0.025396825396825397},
+		{0.20000000000000001, -0.20000000000000001, -0.025396825396825397, -0},
+		{-0, -0.20000000000000001, -0.022222222222222223, 0.022222222222222223},
+		{0.20000000000000001, -0.20000000000000001, -0.022222222222222223, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0.20000000000000001, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.025396825396825397, 0.025396825396825397},
+		{0.20000000000000001, -0.20000000000000001, -0.025396825396825397, -0},
+		{-0.20000000000000001, 0.20000000000000001, 0.022222222222222223, -0.044444444444444446},
+		{0.10000000000000001, -0.10000000000000001, -0.022222222222222223, -0},
+		{-0, -0.20000000000000001, -0.022222222222222223, 0.022222222222222223},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0.20000000000000001, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.025396825396825397, 0.025396825396825397},
+		{0.20000000000000001, -0.20000000000000001, -0.025396825396825397, -0},
+		{-0.10000000000000001, 0.10000000000000001, 0.011111111111111112, -0.033333333333333333},
+		{0.066666666666666666, -0.066666666666666666, -0.022222222222222223, -0},
+		{-0, -0.20000000000000001, -0.022222222222222223, 0.022222222222222223},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0.20000000000000001, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.025396825396825397, 0.025396825396825397},
+		{0.20000000000000001, -0.20000000000000001, -0.025396825396825397, -0},
+		{-0.066666666666666666, 0.066666666666666666, 0.0074074074074074077, -0.029629629629629631},
+		{0.050000000000000003, -0.050000000000000003, -0.022222222222222223, -0},
+		{-0, -0.20000000000000001, -0.022222222222222223, 0.022222222222222223},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0.20000000000000001, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0.20000000000000001, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0.20000000000000001, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.20000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.20000000000000001, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.17777777777777778, -0},
+		{-0, -0.20000000000000001, -0.025396825396825397, 0.025396825396825397},
+		{0.20000000000000001, -0.20000000000000001, -0.025396825396825397, -0},
+		{-0.050000000000000003, 0.050000000000000003, 0.011111111111111112, -0.033333333333333333},
+		{0.033333333333333333, -0.033333333333333333, -0.022222222222222223, -0},
+		{-0, -0.10000000000000001, -0.022222222222222223, 0.022222222222222223},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0.10000000000000001, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.025396825396825397, 0.025396825396825397},
+		{0.10000000000000001, -0.10000000000000001, -0.025396825396825397, -0},
+		{-0.033333333333333333, 0.033333333333333333, 0.0074074074074074077, -0.029629629629629631},
+		{0.025000000000000001, -0.025000000000000001, -0.022222222222222223, -0},
+		{-0, -0.10000000000000001, -0.022222222222222223, 0.022222222222222223},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0.10000000000000001, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0.10000000000000001, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.025396825396825397, 0.025396825396825397},
+		{0.10000000000000001, -0.10000000000000001, -0.025396825396825397, -0},
+		{-0, -0.066666666666666666, -0.022222222222222223, 0.022222222222222223},
+		{0.066666666666666666, -0.066666666666666666, -0.022222222222222223, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0.066666666666666666, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0.066666666666666666, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0.066666666666666666, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0.066666666666666666, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0.066666666666666666, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0.066666666666666666, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0.066666666666666666, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0.066666666666666666, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0.066666666666666666, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0.066666666666666666, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0.066666666666666666, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0.066666666666666666, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0.066666666666666666, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0.066666666666666666, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0.066666666666666666, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0.066666666666666666, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0.066666666666666666, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0.066666666666666666, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.17777777777777778, 0.17777777777777778},
+		{0.066666666666666666, -0.066666666666666666, -0.17777777777777778, -0},
+		{-0, -0.066666666666666666, -0.025396825396825397, 0.025396825396825397},
+		{0.066666666666666666, -0.066666666666666666, -0.025396825396825397, -0},
+		{-0.066666666666666666, 0.066666666666666666, 0.014814814814814815, -0.037037037037037035},
+		{0.040000000000000001, -0.040000000000000001, -0.022222222222222223, -0},
+		{-0, -0.10000000000000001, -0.022222222222222223, 0.022222222222222223},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0.10000000000000001, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0.10000000000000001, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0.10000000000000001, 0, -0.17777777777777778, 0.17777777777777778},
+		{-0, -0.10000000000000001, -0.17777777777777778, 0.17777777777777778},
+		{0.10000000000000001, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.17777777777777778, -0},
+		{-0, -0.10000000000000001, -0.025396825396825397, 0.025396825396825397},
+		{0.10000000000000001, -0.10000000000000001, -0.025396825396825397, -0},
+	};
+}
@@ -0,0 +1,79 @@
+#include <algorithm>
+#include <limits>
+#include "MinimumPhase.h"
+
+
+MinimumPhase::MinimumPhase(int irLength)
+	: irLength_(irLength)
+	// Generous zero padding keeps the time aliasing of the cepstrum negligible
+	, fftSize_(8 * nextPowerOf2(irLength))
+{
+	fft_ = FFT::create(fftSize_);
+	buffer_.resize(fftSize_);
+	spectrum_.resize(fftSize_ / 2 + 1);
+	minPhaseSpectrum_.resize(fftSize_ / 2 + 1);
+}
+
+float MinimumPhase::decompose(const float* ir, float* out, int numTaps)
+{
+	const auto numBins = fftSize_ / 2 + 1;
+	// FFT::ifft() of fft() scales by fftSize / 2
+	const auto scale = 2.f / fftSize_;
+
+	std::copy(ir, ir + irLength_, buffer_.begin());
+	std::fill(buffer_.begin() + irLength_, buffer_.end(), 0.f);
+	fft_->fft(buffer_.data(), spectrum_.data());
+
+	// Real cepstrum; deep notches are floored so the log stays finite
+	auto peak = 0.f;
+	for (auto& bin : spectrum_)
+		peak = std::max(peak, std::abs(bin));
+	const auto floor = std::max(peak * 1e-5f, std::numeric_limits<float>::min());
+	for (auto i = 0; i < numBins; ++i)
+		minPhaseSpectrum_[i] = std::log(std::max(std::abs(spectrum_[i]), floor));
+	fft_->ifft(minPhaseSpectrum_.data(), buffer_.data());
+
+	// Fold the anticausal half of the cepstrum onto the causal half
+	buffer_[0] *= scale;
+	for (auto i = 1; i < fftSize_ / 2; ++i)
+		buffer_[i] *= 2.f * scale;
+	buffer_[fftSize_ / 2] *= scale;
+	std::fill(buffer_.begin() + fftSize_ / 2 + 1, buffer_.end(), 0.f);
+
+	fft_->fft(buffer_.data(), minPhaseSpectrum_.data());
+	for (auto& bin : minPhaseSpectrum_)
+		bin = std::exp(bin);
+
+	// The lag of ir behind the minimum-phase IR is where their cross-correlation peaks.
+	// Both have the same magnitude, so the cross spectrum is |H|^2 times the excess phase.
+	for (auto i = 0; i < numBins; ++i)
+		spectrum_[i] *= std::conj(minPhaseSpectrum_[i]);
+	fft_->ifft(spectrum_.data(), buffer_.data());
+
+	auto lag = 0;
+	for (auto i = 1; i < irLength_; ++i)
+		if (buffer_[i] > buffer_[lag])
+			lag = i;
+	auto delay = static_cast<float>(lag);
+	if (lag > 0 && lag < irLength_ - 1)
+	{
+		// Parabolic interpolation around the peak for the fractional part
+		const auto a = buffer_[lag - 1], b = buffer_[lag], c = buffer_[lag + 1];
+		const auto denominator = a - 2.f * b + c;
+		if (denominator < 0.f)
+			delay += 0.5f * (a - c) / denominator;
+	}
+
+	fft_->ifft(minPhaseSpectrum_.data(), buffer_.data());
+
+	// Truncate with a short fade out to avoid a step at the last tap
+	const auto fadeLength = std::max(1, numTaps / 8);
+	for (auto i = 0; i < numTaps; ++i)
+	{
+		auto gain = scale;
+		if (i >= numTaps - fadeLength)
+			gain *= 0.5f * (1.f + std::cos(Pi * (i - (numTaps - fadeLength) + 1) / (fadeLength + 1)));
+		out[i] = gain * buffer_[i];
+	}
+	return delay;
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include <memory>
+#include <vector>
+#include "FFT.h"
+#include "Util.h"
+
+/** Splits an HRIR into a minimum-phase filter and a pure delay.
+	The minimum-phase part has the same magnitude response as the measured IR
+	but all of its energy at the start, so it can be truncated to far fewer taps
+	and blended between measurements without smearing the onset. The delay is
+	the lag between the two, to be applied separately with a FractionalDelay.
+	Uses the real cepstrum (homomorphic) method.
+*/
+class MinimumPhase
+{
+public:
+	explicit MinimumPhase(int irLength);
+
+	// Writes the first numTaps samples of the minimum-phase version of ir into out
+	// and returns how far ir lags behind it, in samples.
+	float decompose(const float* ir, float* out, int numTaps);
+
+private:
+	int irLength_;
+	int fftSize_;
+	std::unique_ptr<FFT> fft_;
+	std::vector<float> buffer_;
+	ComplexVector<float> spectrum_;
+	ComplexVector<float> minPhaseSpectrum_;
+};
@@ -1,25 +1,54 @@
 #include "OouraFFT.h"
 
 
+OouraFFT::Plan::Plan(size_t nfft)
+	: sineTable(nfft / 2)
+	, complexSineTable(nfft / 2)
+{
+	std::vector<int> ip(2 + (size_t)std::sqrt(nfft));
+	nw = (int)nfft >> 2;
+	makewt(nw, ip.data(), sineTable.data());
+	nc = (int)nfft >> 2;
+	makect(nc, ip.data(), sineTable.data() + nw);
+	// cdft() works on 2 * nfft doubles
+	complexNw = (int)nfft >> 1;
+	makewt(complexNw, ip.data(), complexSineTable.data());
+}
+
 void OouraFFT::init(size_t nfft)
 {
 	assert(isPowerOf2(nfft));
 
-	ip_.resize(2 + (size_t)std::sqrt(nfft / 2));
-	sineTable_.resize(nfft / 2);
+	plan_ = getPlan<Plan>(nfft);
+	// ip[0] and ip[1] tell the routines the tables are built
+	ip_.assign(2 + (size_t)std::sqrt(nfft / 2), 0);
+	ip_[0] = plan_->nw;
+	ip_[1] = plan_->nc;
 	buffer_.resize(nfft);
+
+	complexIp_.assign(2 + (size_t)std::sqrt(nfft), 0);
+	complexIp_[0] = plan_->complexNw;
+	complexBuffer_.resize(2 * nfft);
 }
 
-void OouraFFT::fft(float* in, std::complex<float>* out)
+void OouraFFT::fft(const float* in, std::complex<float>* out)
+{
+	fft(in, in + buffer_.size() / 2, out);
+}
+
+void OouraFFT::fft(const float* firstHalf, const float* secondHalf, std::complex<float>* out)
 {
 	size_t nfft = buffer_.size();
 
 	// copy input data to buffer used by ooura
-	for (size_t i = 0; i < nfft; ++i)
-		buffer_[i] = in[i];
+	for (size_t i = 0; i < nfft / 2; ++i)
+	{
+		buffer_[i] = firstHalf[i];
+		buffer_[i + nfft / 2] = secondHalf[i];
+	}
 
 	// perform forward DFT
-	rdft((int)nfft, +1, buffer_.data(), ip_.data(), sineTable_.data());
+	rdft((int)nfft, +1, buffer_.data(), ip_.data(), plan_->sineTable.data());
 
 	// copy to output from the ooura format
 	for (size_t i = 0; i < nfft / 2; ++i)
@@ -27,10 +56,12 @@ void OouraFFT::fft(float* in, std::complex<float>* out)
 		out[i].real((float)buffer_[i * 2]); //real part
 		out[i].imag((float)buffer_[i * 2 + 1]); // imag part
 	}
-	out[nfft / 2].real((float)buffer_[1]); // a[1] = R[n/2]
+	// a[1] = R[n/2]; DC and Nyquist are real, so products of spectra must not see it in out[0]
+	out[0].imag(0.f);
+	out[nfft / 2] = std::complex<float>((float)buffer_[1], 0.f);
 }
 
-void OouraFFT::ifft(std::complex<float>* in, float* out)
+void OouraFFT::ifft(const std::complex<float>* in, float* out)
 {
 	size_t nfft = buffer_.size();
 
@@ -43,30 +74,46 @@ void OouraFFT::ifft(std::complex<float>* in, float* out)
 	buffer_[1] = in[nfft / 2].real(); // a[1] = R[n/2]
 
 	// perform inverse DFT
-	rdft((int)nfft, -1, buffer_.data(), ip_.data(), sineTable_.data());
+	rdft((int)nfft, -1, buffer_.data(), ip_.data(), plan_->sineTable.data());
 
 	// copy to output
 	for (size_t i = 0; i < nfft; ++i)
 		out[i] = (float)buffer_[i];
 }
 
-void OouraFFT::rdft(int n, int isgn, double * a, int * ip, double * w)
+void OouraFFT::ifftPair(const std::complex<float>* left, const std::complex<float>* right, float* leftOut, float* rightOut)
 {
-	int nw, nc;
-	double xi;
+	const auto nfft = buffer_.size();
+	auto* z = reinterpret_cast<std::complex<double>*>(complexBuffer_.data());
 
-	nw = ip[0];
-	if (n > (nw << 2))
+	// Z = L + iR is the spectrum of left + i right. Ooura's spectra are conjugated,
+	// which the forward complex transform undoes; halving matches ifft()'s scale.
+	const std::complex<double> i(0., 1.);
+	for (size_t k = 0; k <= nfft / 2; ++k)
 	{
-		nw = n >> 2;
-		makewt(nw, ip, w);
+		const std::complex<double> l(left[k]), r(right[k]);
+		z[k] = 0.5 * (std::conj(l) + i * std::conj(r));
+		if (k > 0 && k < nfft / 2)
+			z[nfft - k] = 0.5 * (l + i * r);
 	}
-	nc = ip[1];
-	if (n > (nc << 2))
+
+	cdft((int)(2 * nfft), +1, complexBuffer_.data(), complexIp_.data(), plan_->complexSineTable.data());
+
+	for (size_t n = 0; n < nfft; ++n)
 	{
-		nc = n >> 2;
-		makect(nc, ip, w + nw);
+		leftOut[n] = (float)z[n].real();
+		rightOut[n] = (float)z[n].imag();
 	}
+}
+
+void OouraFFT::rdft(int n, int isgn, double * a, int * ip, const double * w)
+{
+	int nw, nc;
+	double xi;
+
+	// The tables come from the Plan, so unlike the original this never builds them
+	nw = ip[0];
+	nc = ip[1];
 	if (isgn >= 0)
 	{
 		if (n > 4)
@@ -100,6 +147,22 @@ void OouraFFT::rdft(int n, int isgn, double * a, int * ip, double * w)
 	}
 }
 
+void OouraFFT::cdft(int n, int isgn, double * a, int * ip, const double * w)
+{
+	if (n > 4)
+	{
+		bitrv2(n, ip + 2, a);
+	}
+	if (isgn < 0)
+	{
+		cftbsub(n, a, w);
+	}
+	else
+	{
+		cftfsub(n, a, w);
+	}
+}
+
 void OouraFFT::makewt(int nw, int *ip, double *w)
 {
 	int j, nwh;
@@ -259,7 +322,7 @@ void OouraFFT::bitrv2(int n, int *ip, double *a)
 	}
 }
 
-void OouraFFT::cftfsub(int n, double *a, double *w)
+void OouraFFT::cftfsub(int n, double *a, const double *w)
 {
 	int j, j1, j2, j3, l;
 	double x0r, x0i, x1r, x1i, x2r, x2i, x3r, x3i;
@@ -315,7 +378,7 @@ void OouraFFT::cftfsub(int n, double *a, double *w)
 	}
 }
 
-void OouraFFT::cftbsub(int n, double *a, double *w)
+void OouraFFT::cftbsub(int n, double *a, const double *w)
 {
 	int j, j1, j2, j3, l;
 	double x0r, x0i, x1r, x1i, x2r, x2i, x3r, x3i;
@@ -371,7 +434,7 @@ void OouraFFT::cftbsub(int n, double *a, double *w)
 	}
 }
 
-void OouraFFT::rftfsub(int n, double *a, int nc, double *c)
+void OouraFFT::rftfsub(int n, double *a, int nc, const double *c)
 {
 	int j, k, kk, ks, m;
 	double wkr, wki, xr, xi, yr, yi;
@@ -396,7 +459,7 @@ void OouraFFT::rftfsub(int n, double *a, int nc, double *c)
 	}
 }
 
-void OouraFFT::rftbsub(int n, double *a, int nc, double *c)
+void OouraFFT::rftbsub(int n, double *a, int nc, const double *c)
 {
 	int j, k, kk, ks, m;
 	double wkr, wki, xr, xi, yr, yi;
@@ -423,7 +486,7 @@ void OouraFFT::rftbsub(int n, double *a, int nc, double *c)
 	a[m + 1] = -a[m + 1];
 }
 
-void OouraFFT::cft1st(int n, double *a, double *w)
+void OouraFFT::cft1st(int n, double *a, const double *w)
 {
 	int j, k1, k2;
 	double wk1r, wk1i, wk2r, wk2i, wk3r, wk3i;
@@ -528,7 +591,7 @@ void OouraFFT::cft1st(int n, double *a, double *w)
 	}
 }
 
-void OouraFFT::cftmdl(int n, int l, double *a, double *w)
+void OouraFFT::cftmdl(int n, int l, double *a, const double *w)
 {
 	int j, j1, j2, j3, k, k1, k2, m, m2;
 	double wk1r, wk1i, wk2r, wk2i, wk3r, wk3i;
@@ -3,39 +3,53 @@
 #include <cmath>
 #include <complex>
 #include <vector>
+#include "FFT.h"
 #include "Util.h"
 
 
-class OouraFFT
+/** Reference FFT backend: Ooura's double precision radix-4 real FFT. */
+class OouraFFT : public FFT
 {
 public:
-	// prepare for fft/ifft
-	// nfft - size of the future transforms
-	void init(size_t nfft);
+	void init(size_t nfft) override;
+	void fft(const float* in, std::complex<float>* out) override;
+	void fft(const float* firstHalf, const float* secondHalf, std::complex<float>* out) override;
+	void ifft(const std::complex<float>* in, float* out) override;
 
-	// in must have length nfft
-	// out must have length nfft/2 + 1
-	void fft(float* in, std::complex<float>* out);
-
-	// out must have length nfft
-	// in must have length nfft/2 + 1
-	void ifft(std::complex<float>* in, float* out);
+	// Packs both inverse transforms into one complex transform
+	void ifftPair(const std::complex<float>* left, const std::complex<float>* right, float* leftOut, float* rightOut) override;
 
 private:
+	// Sine/cosine tables for one size, built as rdft() and cdft() would on first use
+	struct Plan
+	{
+		explicit Plan(size_t nfft);
+
+		std::vector<double> sineTable; // nw twiddles, then nc cosines for the real transform
+		int nw, nc;
+		// ifftPair() runs a complex transform of nfft points, whose tables differ from rdft's
+		std::vector<double> complexSineTable;
+		int complexNw;
+	};
+
 	// original routines from the ooura fft (fast version, radix 4/2)
 	// see http://www.kurims.kyoto-u.ac.jp/~ooura/fft.html
-	void rdft(int n, int isgn, double *a, int *ip, double *w);
-	void makewt(int nw, int * ip, double * w);
-	void makect(int nc, int * ip, double * c);
-	void bitrv2(int n, int * ip, double * a);
-	void cftfsub(int n, double * a, double * w);
-	void cftbsub(int n, double * a, double * w);
-	void rftfsub(int n, double * a, int nc, double * c);
-	void rftbsub(int n, double * a, int nc, double * c);
-	void cft1st(int n, double * a, double * w);
-	void cftmdl(int n, int l, double * a, double * w);
+	// Only the table builders write to w and c; rdft() and cdft() expect them built.
+	static void rdft(int n, int isgn, double *a, int *ip, const double *w);
+	static void cdft(int n, int isgn, double *a, int *ip, const double *w);
+	static void makewt(int nw, int * ip, double * w);
+	static void makect(int nc, int * ip, double * c);
+	static void bitrv2(int n, int * ip, double * a);
+	static void cftfsub(int n, double * a, const double * w);
+	static void cftbsub(int n, double * a, const double * w);
+	static void rftfsub(int n, double * a, int nc, const double * c);
+	static void rftbsub(int n, double * a, int nc, const double * c);
+	static void cft1st(int n, double * a, const double * w);
+	static void cftmdl(int n, int l, double * a, const double * w);
 
-	std::vector<int> ip_; // work area for bit reversal
-	std::vector<double> sineTable_;
+	std::shared_ptr<const Plan> plan_;
+	std::vector<int> ip_; // table sizes, then the work area for bit reversal
 	std::vector<double> buffer_;
+	std::vector<int> complexIp_;
+	std::vector<double> complexBuffer_;
 };
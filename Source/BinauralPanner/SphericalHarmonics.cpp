@@ -0,0 +1,137 @@
+#include <algorithm>
+#include <cmath>
+#include "SphericalHarmonics.h"
+
+
+void SphericalHarmonics::evaluate(int order, const Point3Cartesian<float>& direction, float* out)
+{
+	const auto x = direction.x, y = direction.y, z = direction.z;
+	out[0] = 1.f;
+	if (order < 1)
+		return;
+	out[1] = y;
+	out[2] = z;
+	out[3] = x;
+	if (order < 2)
+		return;
+	const auto sqrt3 = std::sqrt(3.f);
+	out[4] = sqrt3 * x * y;
+	out[5] = sqrt3 * y * z;
+	out[6] = 0.5f * (3.f * z * z - 1.f);
+	out[7] = sqrt3 * x * z;
+	out[8] = 0.5f * sqrt3 * (x * x - y * y);
+	if (order < 3)
+		return;
+	out[9] = std::sqrt(5.f / 8.f) * y * (3.f * x * x - y * y);
+	out[10] = std::sqrt(15.f) * x * y * z;
+	out[11] = std::sqrt(3.f / 8.f) * y * (5.f * z * z - 1.f);
+	out[12] = 0.5f * z * (5.f * z * z - 3.f);
+	out[13] = std::sqrt(3.f / 8.f) * x * (5.f * z * z - 1.f);
+	out[14] = 0.5f * std::sqrt(15.f) * z * (x * x - y * y);
+	out[15] = std::sqrt(5.f / 8.f) * x * (x * x - 3.f * y * y);
+}
+
+std::vector<Point3Cartesian<float>> SphericalHarmonics::getSphereGrid(int numPoints)
+{
+	std::vector<Point3Cartesian<float>> grid(numPoints);
+	const auto goldenAngle = Pi * (3.f - std::sqrt(5.f));
+	for (auto i = 0; i < numPoints; ++i)
+	{
+		const auto z = 1.f - (2.f * i + 1.f) / numPoints;
+		const auto r = std::sqrt(1.f - z * z);
+		grid[i] = {r * std::cos(goldenAngle * i), r * std::sin(goldenAngle * i), z};
+	}
+	return grid;
+}
+
+void SphericalHarmonics::pseudoInverse(const std::vector<double>& a, int rows, int cols, double regularisation, std::vector<double>& out)
+{
+	// Normal equations, solved by Gauss-Jordan elimination on [a'a + lambda I | a']
+	const auto width = cols + rows;
+	std::vector<double> m(cols * width);
+	auto trace = 0.;
+	for (auto i = 0; i < cols; ++i)
+	{
+		for (auto j = 0; j < cols; ++j)
+		{
+			auto sum = 0.;
+			for (auto k = 0; k < rows; ++k)
+				sum += a[k * cols + i] * a[k * cols + j];
+			m[i * width + j] = sum;
+		}
+		for (auto k = 0; k < rows; ++k)
+			m[i * width + cols + k] = a[k * cols + i];
+		trace += m[i * width + i];
+	}
+	for (auto i = 0; i < cols; ++i)
+		m[i * width + i] += regularisation * trace / cols;
+
+	for (auto i = 0; i < cols; ++i)
+	{
+		auto pivot = i;
+		for (auto r = i + 1; r < cols; ++r)
+			if (std::abs(m[r * width + i]) > std::abs(m[pivot * width + i]))
+				pivot = r;
+		for (auto c = 0; c < width; ++c)
+			std::swap(m[i * width + c], m[pivot * width + c]);
+
+		const auto scale = 1. / m[i * width + i];
+		for (auto c = 0; c < width; ++c)
+			m[i * width + c] *= scale;
+		for (auto r = 0; r < cols; ++r)
+		{
+			const auto factor = m[r * width + i];
+			if (r == i || factor == 0.)
+				continue;
+			for (auto c = 0; c < width; ++c)
+				m[r * width + c] -= factor * m[i * width + c];
+		}
+	}
+
+	out.resize(cols * rows);
+	for (auto i = 0; i < cols; ++i)
+		std::copy(m.begin() + i * width + cols, m.begin() + (i + 1) * width, out.begin() + i * rows);
+}
+
+SphericalHarmonics::Rotation::Rotation(int order)
+	: order_(order)
+	, numChannels_(getNumChannels(order))
+	// Twice as many points as harmonics keeps the fit well conditioned
+	, grid_(getSphereGrid(2 * numChannels_))
+{
+	const auto numPoints = static_cast<int>(grid_.size());
+	std::vector<double> a(numPoints * numChannels_);
+	float harmonics[cMaxChannels];
+	for (auto i = 0; i < numPoints; ++i)
+	{
+		evaluate(order_, grid_[i], harmonics);
+		std::copy(harmonics, harmonics + numChannels_, a.begin() + i * numChannels_);
+	}
+	std::vector<double> inverse;
+	pseudoInverse(a, numPoints, numChannels_, 0., inverse);
+	pseudoInverse_.assign(inverse.begin(), inverse.end());
+}
+
+void SphericalHarmonics::Rotation::getMatrix(const float (&rotation)[3][3], float* matrix) const
+{
+	// The rotated harmonics at each grid point, fitted back onto the unrotated ones:
+	// matrix = Y(rotation * grid) * pinv(Y(grid)), keeping only the blocks of each order
+	const auto numPoints = static_cast<int>(grid_.size());
+	std::fill(matrix, matrix + numChannels_ * numChannels_, 0.f);
+	float harmonics[cMaxChannels];
+	for (auto i = 0; i < numPoints; ++i)
+	{
+		const auto& d = grid_[i];
+		const Point3Cartesian<float> rotated = {
+			rotation[0][0] * d.x + rotation[0][1] * d.y + rotation[0][2] * d.z,
+			rotation[1][0] * d.x + rotation[1][1] * d.y + rotation[1][2] * d.z,
+			rotation[2][0] * d.x + rotation[2][1] * d.y + rotation[2][2] * d.z};
+		evaluate(order_, rotated, harmonics);
+		for (auto row = 0; row < numChannels_; ++row)
+		{
+			const auto order = getOrder(row);
+			for (auto col = order * order; col < (order + 1) * (order + 1); ++col)
+				matrix[row * numChannels_ + col] += harmonics[row] * pseudoInverse_[col * numPoints + i];
+		}
+	}
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include <cmath>
+#include <vector>
+#include "Util.h"
+
+/** Real spherical harmonics up to third order, as used for Ambisonics: ACN channel order and
+	SN3D normalisation (AmbiX), so channel 0 is 1 in every direction.
+	Directions are unit vectors with x to the front, y to the left and z up.
+*/
+namespace SphericalHarmonics
+{
+	const int cMaxOrder = 3;
+	const int cMaxChannels = (cMaxOrder + 1) * (cMaxOrder + 1);
+
+	inline int getNumChannels(int order) { return (order + 1) * (order + 1); }
+	// Channels of one order are [order^2, (order + 1)^2)
+	inline int getOrder(int channel) { return static_cast<int>(std::sqrt(static_cast<float>(channel))); }
+
+	// Writes getNumChannels(order) values
+	void evaluate(int order, const Point3Cartesian<float>& direction, float* out);
+
+	// Near-uniform directions on the sphere (a Fibonacci lattice)
+	std::vector<Point3Cartesian<float>> getSphereGrid(int numPoints);
+
+	// Regularised least squares: out = (a' a + regularisation * I)^-1 a', for fitting the values
+	// of a function in rows sampled directions with cols harmonics. a is rows x cols and out
+	// cols x rows, both row major. regularisation is relative to the mean of diag(a' a).
+	void pseudoInverse(const std::vector<double>& a, int rows, int cols, double regularisation, std::vector<double>& out);
+
+	/** Rotates an Ambisonic scene: the matrix that takes the harmonics of a scene to those of
+		the scene turned by a given rotation. It only mixes channels within each order.
+		Found by fitting over a fixed grid, whose pseudo-inverse is computed once.
+	*/
+	class Rotation
+	{
+	public:
+		explicit Rotation(int order);
+
+		// rotation is a 3x3 rotation of directions, matrix getNumChannels(order) squared, both row major
+		void getMatrix(const float (&rotation)[3][3], float* matrix) const;
+
+	private:
+		int order_;
+		int numChannels_;
+		std::vector<Point3Cartesian<float>> grid_;
+		std::vector<float> pseudoInverse_; // [channel][grid point]
+	};
+}
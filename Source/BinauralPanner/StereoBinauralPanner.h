@@ -11,37 +11,90 @@
 #define STEREOBINAURALPANNER_H_INCLUDED
 
 #include "BinauralPanner.h"
+#include "BinauralMixer.h"
 
 class StereoBinauralPanner
 {
 public:
   StereoBinauralPanner()
+  : mVirtualSpeakers(false)
+  , mSampleRate(0.)
+  , mBlockSize(0)
+  , mWidth(0.f)
+  , mElevation(0.f)
   {
+    mSpeakers.setNumSources(2);
+    mSpeakers.setDelaysInFilters(true);
   }
   
   ~StereoBinauralPanner()
   {
   }
   
+  // Only prepares the rendering in use, see setVirtualSpeakers()
   void prepareToPlay (double sampleRate, int estimatedSamplesPerBlock)
   {
-    mPannerLeft.prepareToPlay(sampleRate, estimatedSamplesPerBlock);
-    mPannerRight.prepareToPlay(sampleRate, estimatedSamplesPerBlock);
-    mScratchBuffer.setSize(2, estimatedSamplesPerBlock);
+    mSampleRate = sampleRate;
+    mBlockSize = estimatedSamplesPerBlock;
+    
+    if(mVirtualSpeakers)
+      mSpeakers.prepareToPlay(sampleRate, estimatedSamplesPerBlock);
+    else
+    {
+      mPannerLeft.prepareToPlay(sampleRate, estimatedSamplesPerBlock);
+      mPannerRight.prepareToPlay(sampleRate, estimatedSamplesPerBlock);
+      mScratchBuffer.setSize(2, estimatedSamplesPerBlock);
+    }
   }
   
   void processBlock(AudioBuffer<float> &buffer)
   {
+    if(mVirtualSpeakers)
+    {
+      mSpeakers.processBlock(buffer);
+      return;
+    }
+    
     auto bufferLength = buffer.getNumSamples();
     
-    mScratchBuffer.copyFrom(0, 0, buffer, 0, 0, bufferLength);
-    mScratchBuffer.copyFrom(1, 0, buffer, 1, 0, bufferLength);
+    // the panners take their length from the buffer, so the scratch space is wrapped to the
+    // host's block rather than handed over at the size prepareToPlay() allocated
+    AudioBuffer<float> scratch(mScratchBuffer.getArrayOfWritePointers(), 2, bufferLength);
+    scratch.copyFrom(0, 0, buffer, 0, 0, bufferLength);
+    scratch.copyFrom(1, 0, buffer, 1, 0, bufferLength);
     
     mPannerLeft.processBlock(buffer, 0);
-    mPannerRight.processBlock(mScratchBuffer, 1);
+    mPannerRight.processBlock(scratch, 1);
+    
+    buffer.addFrom(0, 0, scratch, 0, 0, bufferLength);
+    buffer.addFrom(1, 0, scratch, 1, 0, bufferLength);
+  }
+  
+  int getLatencySamples() const
+  {
+    return mVirtualSpeakers ? mSpeakers.getLatencySamples() : mPannerLeft.getLatencySamples();
+  }
+  
+  // Renders the channels as two fixed virtual speakers: one forward transform per channel,
+  // summed into one inverse transform per ear, with the speakers' 2x2 HRTFs, interaural
+  // delays included, prepared in the background on each width or elevation change, see BinauralMixer.
+  // Much cheaper while width and elevation hold still, but takes no zero latency. Call while
+  // not processing, and before prepareToPlay() for the host to pick up the new latency; once
+  // prepared, switching prepares the rendering switched to.
+  void setVirtualSpeakers(bool virtualSpeakers)
+  {
+    if(virtualSpeakers == mVirtualSpeakers)
+      return;
     
-    buffer.addFrom(0, 0, mScratchBuffer, 0, 0, bufferLength);
-    buffer.addFrom(1, 0, mScratchBuffer, 1, 0, bufferLength);
+    mVirtualSpeakers = virtualSpeakers;
+    if(mBlockSize > 0)
+      prepareToPlay(mSampleRate, mBlockSize);
+  }
+  
+  void setZeroLatency(bool zeroLatency)
+  {
+    mPannerLeft.setZeroLatency(zeroLatency);
+    mPannerRight.setZeroLatency(zeroLatency);
   }
   
   void setWidth(float width)
@@ -50,24 +103,67 @@ public:
     
     mPannerLeft.setAzimuth(0. - width);
     mPannerRight.setAzimuth(width);
+    mWidth = width;
+    updateSpeakers();
   }
 
   void setElevation(float elevation)
   {
     mPannerLeft.setElevation(elevation);
     mPannerRight.setElevation(elevation);
+    mElevation = elevation;
+    updateSpeakers();
+  }
+  
+  void setUpdateInterval(int samples)
+  {
+    mPannerLeft.setUpdateInterval(samples);
+    mPannerRight.setUpdateInterval(samples);
+  }
+  
+  void setUpdateThreshold(float degrees)
+  {
+    mPannerLeft.setUpdateThreshold(degrees);
+    mPannerRight.setUpdateThreshold(degrees);
   }
   
   void setCrossoverFreq(float freq)
   {
     mPannerLeft.setCrossoverFreq(freq);
     mPannerRight.setCrossoverFreq(freq);
+    mSpeakers.setCrossoverFreq(freq);
+  }
+  
+  bool loadHRTFSet(const File& file, const HRTFDatabase::LoadOptions& options = BinauralPanner::getDefaultHRTFOptions())
+  {
+    return mPannerLeft.loadHRTFSet(file, options) && mPannerRight.loadHRTFSet(file, options)
+      && mSpeakers.loadHRTFSet(file, options);
+  }
+  
+  void setHRTFLookupResolution(double azimuthStep, double elevationStep)
+  {
+    mPannerLeft.setHRTFLookupResolution(azimuthStep, elevationStep);
+    mPannerRight.setHRTFLookupResolution(azimuthStep, elevationStep);
+    mSpeakers.setHRTFLookupResolution(azimuthStep, elevationStep);
   }
   
 private:
+  void updateSpeakers()
+  {
+    // the mixer only rebuilds a speaker's filters when its position has changed
+    mSpeakers.setPosition(0, 0. - mWidth, mElevation);
+    mSpeakers.setPosition(1, mWidth, mElevation);
+  }
+  
   BinauralPanner mPannerLeft;
   BinauralPanner mPannerRight;
   AudioSampleBuffer mScratchBuffer;
+  
+  bool mVirtualSpeakers;
+  double mSampleRate;
+  int mBlockSize;
+  float mWidth, mElevation;
+  BinauralMixer mSpeakers; // for setVirtualSpeakers()
 };
 
 
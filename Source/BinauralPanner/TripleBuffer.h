@@ -0,0 +1,51 @@
+#pragma once
+#include <atomic>
+#include "../JuceLibraryCode/JuceHeader.h"
+
+/** Lock-free handover of the newest value from one writer thread to one reader thread.
+	The writer fills getWriteBuffer() and publish()es it; the reader calls update() to take
+	the most recently published buffer, if there is a new one, and reads getReadBuffer().
+	Neither side ever waits for the other, and values published in between are skipped.
+*/
+template <typename T>
+class TripleBuffer
+{
+public:
+	TripleBuffer()
+	{
+		jassert(middle_.is_lock_free());
+	}
+
+	// Writer side
+	T& getWriteBuffer() { return buffers_[writeIndex_]; }
+	void publish() { writeIndex_ = middle_.exchange(writeIndex_ | FRESH) & INDEX_MASK; }
+
+	// Reader side
+	bool update()
+	{
+		if ((middle_.load() & FRESH) == 0)
+			return false;
+		readIndex_ = middle_.exchange(readIndex_) & INDEX_MASK;
+		return true;
+	}
+	const T& getReadBuffer() const { return buffers_[readIndex_]; }
+
+	// Applies f to all three buffers and drops anything published but not yet read.
+	// Only call this while neither side is running.
+	template <typename Function>
+	void resetAll(Function f)
+	{
+		for (auto& buffer : buffers_)
+			f(buffer);
+		middle_ = readIndex_ ^ writeIndex_ ^ 3;
+	}
+
+private:
+	static const int INDEX_MASK = 3;
+	static const int FRESH = 4;
+
+	T buffers_[3];
+	int writeIndex_ = 0;
+	std::atomic_int middle_ {1}; // index of the spare buffer, plus FRESH once published
+	int readIndex_ = 2;
+};
@@ -0,0 +1,387 @@
+#include "VectorOps.h"
+
+#if VECTOROPS_X86
+ #include <immintrin.h>
+ #if defined(_MSC_VER)
+  #include <intrin.h>
+ #endif
+ #if defined(__GNUC__) || defined(__clang__)
+  #define VECTOROPS_AVX __attribute__((target("avx")))
+ #else
+  #define VECTOROPS_AVX
+ #endif
+#endif
+
+//==============================================================================
+void VectorOps::Scalar::blend3(const float* a, const float* b, const float* c, const float (&g)[3], float* out, int n)
+{
+	for (auto i = 0; i < n; ++i)
+		out[i] = g[0] * a[i] + g[1] * b[i] + g[2] * c[i];
+}
+
+void VectorOps::Scalar::blend3(const int16_t* a, const int16_t* b, const int16_t* c, const float (&g)[3], float* out, int n)
+{
+	for (auto i = 0; i < n; ++i)
+		out[i] = g[0] * a[i] + g[1] * b[i] + g[2] * c[i];
+}
+
+void VectorOps::Scalar::complexMultiply(const std::complex<float>* x, const std::complex<float>* h, float scale,
+	std::complex<float>* out, int n)
+{
+	for (auto i = 0; i < n; ++i)
+		out[i] = scale * x[i] * h[i];
+}
+
+void VectorOps::Scalar::complexMultiplyAdd(const std::complex<float>* x, const std::complex<float>* h,
+	std::complex<float>* out, int n)
+{
+	for (auto i = 0; i < n; ++i)
+		out[i] += x[i] * h[i];
+}
+
+void VectorOps::Scalar::crossfade(const std::complex<float>* current, const std::complex<float>* target,
+	std::complex<float>* out, int n)
+{
+	// With Y0 the current and Y1 the target spectrum and D = Y1 - Y0:
+	// out[i] = Y0[i] + Y1[i] + 0.5 D[i - 1] + 0.5 D[i + 1], i.e. in time y0 (1 - cos) + y1 (1 + cos)
+	// with cos = cos(2 pi t / nfft). Past DC and Nyquist, D[-1] and D[n] are conj D[1] and conj D[n - 2].
+	out[0] = current[0] + target[0] + (target[1] - current[1]).real();
+	for (auto i = 1; i < n - 1; ++i)
+		out[i] = current[i] + target[i] + 0.5f * (target[i - 1] - current[i - 1] + target[i + 1] - current[i + 1]);
+	out[n - 1] = current[n - 1] + target[n - 1] + (target[n - 2] - current[n - 2]).real();
+}
+
+void VectorOps::Scalar::fir(const float* x, const float* hL, const float* hR, int taps, float* left, float* right, int n)
+{
+	for (auto i = 0; i < n; ++i)
+	{
+		auto sumL = 0.f, sumR = 0.f;
+		for (auto k = 0; k < taps; ++k)
+		{
+			sumL += hL[k] * x[i - k];
+			sumR += hR[k] * x[i - k];
+		}
+		left[i] += sumL;
+		right[i] += sumR;
+	}
+}
+
+#if VECTOROPS_X86
+//==============================================================================
+namespace
+{
+	// Two interleaved complex products
+	inline __m128 complexMultiplySSE(__m128 a, __m128 b)
+	{
+		const auto signs = _mm_set_ps(0.f, -0.f, 0.f, -0.f);
+		const auto bRe = _mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 2, 0, 0));
+		const auto bIm = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 3, 1, 1));
+		const auto aSwapped = _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1));
+		return _mm_add_ps(_mm_mul_ps(a, bRe), _mm_xor_ps(_mm_mul_ps(aSwapped, bIm), signs));
+	}
+
+	// Sign-extends four 16-bit integers and converts them to float
+	inline __m128 loadInt16SSE(const int16_t* p)
+	{
+		const auto packed = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p));
+		return _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(packed, packed), 16));
+	}
+
+	// Four interleaved complex products
+	VECTOROPS_AVX inline __m256 complexMultiplyAVX(__m256 a, __m256 b)
+	{
+		const auto bRe = _mm256_moveldup_ps(b);
+		const auto bIm = _mm256_movehdup_ps(b);
+		const auto aSwapped = _mm256_permute_ps(a, _MM_SHUFFLE(2, 3, 0, 1));
+		return _mm256_addsub_ps(_mm256_mul_ps(a, bRe), _mm256_mul_ps(aSwapped, bIm));
+	}
+}
+
+void VectorOps::Sse2::blend3(const float* a, const float* b, const float* c, const float (&g)[3], float* out, int n)
+{
+	const auto g0 = _mm_set1_ps(g[0]), g1 = _mm_set1_ps(g[1]), g2 = _mm_set1_ps(g[2]);
+	auto i = 0;
+	for (; i + 4 <= n; i += 4)
+	{
+		const auto sum = _mm_add_ps(_mm_add_ps(_mm_mul_ps(g0, _mm_loadu_ps(a + i)), _mm_mul_ps(g1, _mm_loadu_ps(b + i))),
+			_mm_mul_ps(g2, _mm_loadu_ps(c + i)));
+		_mm_storeu_ps(out + i, sum);
+	}
+	VectorOps::Scalar::blend3(a + i, b + i, c + i, g, out + i, n - i);
+}
+
+void VectorOps::Sse2::blend3(const int16_t* a, const int16_t* b, const int16_t* c, const float (&g)[3], float* out, int n)
+{
+	const auto g0 = _mm_set1_ps(g[0]), g1 = _mm_set1_ps(g[1]), g2 = _mm_set1_ps(g[2]);
+	auto i = 0;
+	for (; i + 4 <= n; i += 4)
+	{
+		const auto sum = _mm_add_ps(_mm_add_ps(_mm_mul_ps(g0, loadInt16SSE(a + i)), _mm_mul_ps(g1, loadInt16SSE(b + i))),
+			_mm_mul_ps(g2, loadInt16SSE(c + i)));
+		_mm_storeu_ps(out + i, sum);
+	}
+	VectorOps::Scalar::blend3(a + i, b + i, c + i, g, out + i, n - i);
+}
+
+void VectorOps::Sse2::complexMultiply(const std::complex<float>* x, const std::complex<float>* h, float scale,
+	std::complex<float>* out, int n)
+{
+	const auto* xf = reinterpret_cast<const float*>(x);
+	const auto* hf = reinterpret_cast<const float*>(h);
+	auto* outf = reinterpret_cast<float*>(out);
+	const auto s = _mm_set1_ps(scale);
+	auto i = 0;
+	for (; i + 2 <= n; i += 2)
+		_mm_storeu_ps(outf + 2 * i, _mm_mul_ps(s, complexMultiplySSE(_mm_loadu_ps(xf + 2 * i), _mm_loadu_ps(hf + 2 * i))));
+	VectorOps::Scalar::complexMultiply(x + i, h + i, scale, out + i, n - i);
+}
+
+void VectorOps::Sse2::complexMultiplyAdd(const std::complex<float>* x, const std::complex<float>* h, std::complex<float>* out, int n)
+{
+	const auto* xf = reinterpret_cast<const float*>(x);
+	const auto* hf = reinterpret_cast<const float*>(h);
+	auto* outf = reinterpret_cast<float*>(out);
+	auto i = 0;
+	for (; i + 2 <= n; i += 2)
+	{
+		const auto product = complexMultiplySSE(_mm_loadu_ps(xf + 2 * i), _mm_loadu_ps(hf + 2 * i));
+		_mm_storeu_ps(outf + 2 * i, _mm_add_ps(_mm_loadu_ps(outf + 2 * i), product));
+	}
+	VectorOps::Scalar::complexMultiplyAdd(x + i, h + i, out + i, n - i);
+}
+
+void VectorOps::Sse2::crossfade(const std::complex<float>* current, const std::complex<float>* target, std::complex<float>* out, int n)
+{
+	const auto* y0 = reinterpret_cast<const float*>(current);
+	const auto* y1 = reinterpret_cast<const float*>(target);
+	auto* outf = reinterpret_cast<float*>(out);
+	const auto half = _mm_set1_ps(0.5f);
+
+	out[0] = current[0] + target[0] + (target[1] - current[1]).real();
+	auto i = 1;
+	for (; i + 2 <= n - 1; i += 2)
+	{
+		const auto previous = _mm_sub_ps(_mm_loadu_ps(y1 + 2 * (i - 1)), _mm_loadu_ps(y0 + 2 * (i - 1)));
+		const auto next = _mm_sub_ps(_mm_loadu_ps(y1 + 2 * (i + 1)), _mm_loadu_ps(y0 + 2 * (i + 1)));
+		const auto sum = _mm_add_ps(_mm_loadu_ps(y0 + 2 * i), _mm_loadu_ps(y1 + 2 * i));
+		_mm_storeu_ps(outf + 2 * i, _mm_add_ps(sum, _mm_mul_ps(half, _mm_add_ps(previous, next))));
+	}
+	for (; i < n - 1; ++i)
+		out[i] = current[i] + target[i] + 0.5f * (target[i - 1] - current[i - 1] + target[i + 1] - current[i + 1]);
+	out[n - 1] = current[n - 1] + target[n - 1] + (target[n - 2] - current[n - 2]).real();
+}
+
+void VectorOps::Sse2::fir(const float* x, const float* hL, const float* hR, int taps, float* left, float* right, int n)
+{
+	// Eight outputs per ear stay in registers while the taps go by, one broadcast per tap
+	auto i = 0;
+	for (; i + 8 <= n; i += 8)
+	{
+		auto l0 = _mm_setzero_ps(), l1 = _mm_setzero_ps(), r0 = _mm_setzero_ps(), r1 = _mm_setzero_ps();
+		for (auto k = 0; k < taps; ++k)
+		{
+			const auto x0 = _mm_loadu_ps(x + i - k), x1 = _mm_loadu_ps(x + i - k + 4);
+			const auto gL = _mm_set1_ps(hL[k]), gR = _mm_set1_ps(hR[k]);
+			l0 = _mm_add_ps(l0, _mm_mul_ps(gL, x0));
+			l1 = _mm_add_ps(l1, _mm_mul_ps(gL, x1));
+			r0 = _mm_add_ps(r0, _mm_mul_ps(gR, x0));
+			r1 = _mm_add_ps(r1, _mm_mul_ps(gR, x1));
+		}
+		_mm_storeu_ps(left + i, _mm_add_ps(_mm_loadu_ps(left + i), l0));
+		_mm_storeu_ps(left + i + 4, _mm_add_ps(_mm_loadu_ps(left + i + 4), l1));
+		_mm_storeu_ps(right + i, _mm_add_ps(_mm_loadu_ps(right + i), r0));
+		_mm_storeu_ps(right + i + 4, _mm_add_ps(_mm_loadu_ps(right + i + 4), r1));
+	}
+	VectorOps::Scalar::fir(x + i, hL, hR, taps, left + i, right + i, n - i);
+}
+
+//==============================================================================
+VECTOROPS_AVX void VectorOps::Avx::blend3(const float* a, const float* b, const float* c, const float (&g)[3], float* out, int n)
+{
+	const auto g0 = _mm256_set1_ps(g[0]), g1 = _mm256_set1_ps(g[1]), g2 = _mm256_set1_ps(g[2]);
+	auto i = 0;
+	for (; i + 8 <= n; i += 8)
+	{
+		const auto sum = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(g0, _mm256_loadu_ps(a + i)),
+			_mm256_mul_ps(g1, _mm256_loadu_ps(b + i))), _mm256_mul_ps(g2, _mm256_loadu_ps(c + i)));
+		_mm256_storeu_ps(out + i, sum);
+	}
+	_mm256_zeroupper();
+	VectorOps::Sse2::blend3(a + i, b + i, c + i, g, out + i, n - i);
+}
+
+VECTOROPS_AVX void VectorOps::Avx::complexMultiply(const std::complex<float>* x, const std::complex<float>* h, float scale,
+	std::complex<float>* out, int n)
+{
+	const auto* xf = reinterpret_cast<const float*>(x);
+	const auto* hf = reinterpret_cast<const float*>(h);
+	auto* outf = reinterpret_cast<float*>(out);
+	const auto s = _mm256_set1_ps(scale);
+	auto i = 0;
+	for (; i + 4 <= n; i += 4)
+		_mm256_storeu_ps(outf + 2 * i, _mm256_mul_ps(s, complexMultiplyAVX(_mm256_loadu_ps(xf + 2 * i), _mm256_loadu_ps(hf + 2 * i))));
+	_mm256_zeroupper();
+	VectorOps::Scalar::complexMultiply(x + i, h + i, scale, out + i, n - i);
+}
+
+VECTOROPS_AVX void VectorOps::Avx::complexMultiplyAdd(const std::complex<float>* x, const std::complex<float>* h,
+	std::complex<float>* out, int n)
+{
+	const auto* xf = reinterpret_cast<const float*>(x);
+	const auto* hf = reinterpret_cast<const float*>(h);
+	auto* outf = reinterpret_cast<float*>(out);
+	auto i = 0;
+	for (; i + 4 <= n; i += 4)
+	{
+		const auto product = complexMultiplyAVX(_mm256_loadu_ps(xf + 2 * i), _mm256_loadu_ps(hf + 2 * i));
+		_mm256_storeu_ps(outf + 2 * i, _mm256_add_ps(_mm256_loadu_ps(outf + 2 * i), product));
+	}
+	_mm256_zeroupper();
+	VectorOps::Scalar::complexMultiplyAdd(x + i, h + i, out + i, n - i);
+}
+
+VECTOROPS_AVX void VectorOps::Avx::crossfade(const std::complex<float>* current, const std::complex<float>* target,
+	std::complex<float>* out, int n)
+{
+	const auto* y0 = reinterpret_cast<const float*>(current);
+	const auto* y1 = reinterpret_cast<const float*>(target);
+	auto* outf = reinterpret_cast<float*>(out);
+	const auto half = _mm256_set1_ps(0.5f);
+
+	out[0] = current[0] + target[0] + (target[1] - current[1]).real();
+	auto i = 1;
+	for (; i + 4 <= n - 1; i += 4)
+	{
+		const auto previous = _mm256_sub_ps(_mm256_loadu_ps(y1 + 2 * (i - 1)), _mm256_loadu_ps(y0 + 2 * (i - 1)));
+		const auto next = _mm256_sub_ps(_mm256_loadu_ps(y1 + 2 * (i + 1)), _mm256_loadu_ps(y0 + 2 * (i + 1)));
+		const auto sum = _mm256_add_ps(_mm256_loadu_ps(y0 + 2 * i), _mm256_loadu_ps(y1 + 2 * i));
+		_mm256_storeu_ps(outf + 2 * i, _mm256_add_ps(sum, _mm256_mul_ps(half, _mm256_add_ps(previous, next))));
+	}
+	_mm256_zeroupper();
+	for (; i < n - 1; ++i)
+		out[i] = current[i] + target[i] + 0.5f * (target[i - 1] - current[i - 1] + target[i + 1] - current[i + 1]);
+	out[n - 1] = current[n - 1] + target[n - 1] + (target[n - 2] - current[n - 2]).real();
+}
+
+VECTOROPS_AVX void VectorOps::Avx::fir(const float* x, const float* hL, const float* hR, int taps, float* left, float* right, int n)
+{
+	auto i = 0;
+	for (; i + 16 <= n; i += 16)
+	{
+		auto l0 = _mm256_setzero_ps(), l1 = _mm256_setzero_ps(), r0 = _mm256_setzero_ps(), r1 = _mm256_setzero_ps();
+		for (auto k = 0; k < taps; ++k)
+		{
+			const auto x0 = _mm256_loadu_ps(x + i - k), x1 = _mm256_loadu_ps(x + i - k + 8);
+			const auto gL = _mm256_broadcast_ss(hL + k), gR = _mm256_broadcast_ss(hR + k);
+			l0 = _mm256_add_ps(l0, _mm256_mul_ps(gL, x0));
+			l1 = _mm256_add_ps(l1, _mm256_mul_ps(gL, x1));
+			r0 = _mm256_add_ps(r0, _mm256_mul_ps(gR, x0));
+			r1 = _mm256_add_ps(r1, _mm256_mul_ps(gR, x1));
+		}
+		_mm256_storeu_ps(left + i, _mm256_add_ps(_mm256_loadu_ps(left + i), l0));
+		_mm256_storeu_ps(left + i + 8, _mm256_add_ps(_mm256_loadu_ps(left + i + 8), l1));
+		_mm256_storeu_ps(right + i, _mm256_add_ps(_mm256_loadu_ps(right + i), r0));
+		_mm256_storeu_ps(right + i + 8, _mm256_add_ps(_mm256_loadu_ps(right + i + 8), r1));
+	}
+	// Small host blocks often leave just eight
+	if (i + 8 <= n)
+	{
+		auto l = _mm256_setzero_ps(), r = _mm256_setzero_ps();
+		for (auto k = 0; k < taps; ++k)
+		{
+			const auto xk = _mm256_loadu_ps(x + i - k);
+			l = _mm256_add_ps(l, _mm256_mul_ps(_mm256_broadcast_ss(hL + k), xk));
+			r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_broadcast_ss(hR + k), xk));
+		}
+		_mm256_storeu_ps(left + i, _mm256_add_ps(_mm256_loadu_ps(left + i), l));
+		_mm256_storeu_ps(right + i, _mm256_add_ps(_mm256_loadu_ps(right + i), r));
+		i += 8;
+	}
+	_mm256_zeroupper();
+	VectorOps::Sse2::fir(x + i, hL, hR, taps, left + i, right + i, n - i);
+}
+
+bool VectorOps::Avx::isSupported()
+{
+   #if defined(_MSC_VER)
+	// The CPU has AVX and the OS saves the 256-bit registers
+	int info[4];
+	__cpuid(info, 1);
+	return (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 && (_xgetbv(0) & 6) == 6;
+   #else
+	return __builtin_cpu_supports("avx") != 0;
+   #endif
+}
+#endif
+
+//==============================================================================
+namespace
+{
+	typedef void (*Blend3)(const float*, const float*, const float*, const float (&)[3], float*, int);
+	typedef void (*Blend3Int16)(const int16_t*, const int16_t*, const int16_t*, const float (&)[3], float*, int);
+
+	struct Kernels
+	{
+		Blend3 blend3;
+		Blend3Int16 blend3Int16;
+		decltype(&VectorOps::Scalar::complexMultiply) complexMultiply;
+		decltype(&VectorOps::Scalar::complexMultiplyAdd) complexMultiplyAdd;
+		decltype(&VectorOps::Scalar::crossfade) crossfade;
+		decltype(&VectorOps::Scalar::fir) fir;
+	};
+
+	Kernels selectKernels()
+	{
+		Kernels kernels = {&VectorOps::Scalar::blend3, &VectorOps::Scalar::blend3, &VectorOps::Scalar::complexMultiply,
+			&VectorOps::Scalar::complexMultiplyAdd, &VectorOps::Scalar::crossfade, &VectorOps::Scalar::fir};
+	   #if VECTOROPS_X86
+		// AVX has no 256-bit integer unpacking, so 16-bit data always takes the SSE2 path
+		if (VectorOps::Avx::isSupported())
+			kernels = {&VectorOps::Avx::blend3, &VectorOps::Sse2::blend3, &VectorOps::Avx::complexMultiply,
+				&VectorOps::Avx::complexMultiplyAdd, &VectorOps::Avx::crossfade, &VectorOps::Avx::fir};
+		else
+			kernels = {&VectorOps::Sse2::blend3, &VectorOps::Sse2::blend3, &VectorOps::Sse2::complexMultiply,
+				&VectorOps::Sse2::complexMultiplyAdd, &VectorOps::Sse2::crossfade, &VectorOps::Sse2::fir};
+	   #endif
+		return kernels;
+	}
+
+	const Kernels& getKernels()
+	{
+		static const Kernels kernels = selectKernels();
+		return kernels;
+	}
+}
+
+void VectorOps::blend3(const float* a, const float* b, const float* c, const float (&g)[3], float* out, int n)
+{
+	getKernels().blend3(a, b, c, g, out, n);
+}
+
+void VectorOps::blend3(const int16_t* a, const int16_t* b, const int16_t* c, const float (&g)[3], float* out, int n)
+{
+	getKernels().blend3Int16(a, b, c, g, out, n);
+}
+
+void VectorOps::complexMultiply(const std::complex<float>* x, const std::complex<float>* h, float scale,
+	std::complex<float>* out, int n)
+{
+	getKernels().complexMultiply(x, h, scale, out, n);
+}
+
+void VectorOps::complexMultiplyAdd(const std::complex<float>* x, const std::complex<float>* h,
+	std::complex<float>* out, int n)
+{
+	getKernels().complexMultiplyAdd(x, h, out, n);
+}
+
+void VectorOps::crossfade(const std::complex<float>* current, const std::complex<float>* target,
+	std::complex<float>* out, int n)
+{
+	getKernels().crossfade(current, target, out, n);
+}
+
+void VectorOps::fir(const float* x, const float* hL, const float* hR, int taps, float* left, float* right, int n)
+{
+	getKernels().fir(x, hL, hR, taps, left, right, n);
+}
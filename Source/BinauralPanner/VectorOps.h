@@ -0,0 +1,75 @@
+#pragma once
+#include <complex>
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+ #define VECTOROPS_X86 1
+#else
+ #define VECTOROPS_X86 0
+#endif
+
+/** The inner loops of HRIR interpolation and HRIRFilter.
+	Each kernel has a portable scalar version in VectorOps::Scalar, kept as the reference;
+	the top-level functions dispatch once, at first use, to SSE2 or AVX versions when the
+	CPU has them.
+*/
+namespace VectorOps
+{
+	// out[i] = g[0] * a[i] + g[1] * b[i] + g[2] * c[i]
+	void blend3(const float* a, const float* b, const float* c, const float (&g)[3], float* out, int n);
+	// Same for 16-bit storage; fold the scale of the data into g
+	void blend3(const int16_t* a, const int16_t* b, const int16_t* c, const float (&g)[3], float* out, int n);
+
+	// out[i] = scale * x[i] * h[i]
+	void complexMultiply(const std::complex<float>* x, const std::complex<float>* h, float scale,
+		std::complex<float>* out, int n);
+
+	// out[i] += x[i] * h[i]
+	void complexMultiplyAdd(const std::complex<float>* x, const std::complex<float>* h, std::complex<float>* out, int n);
+
+	// Given the spectra of one block filtered through the current and the target filter,
+	// the spectrum of a crossfade between them over the block, see HRIRFilter.cpp.
+	// Twice the filtered spectrum when both are the same. n must be at least 2.
+	void crossfade(const std::complex<float>* current, const std::complex<float>* target, std::complex<float>* out, int n);
+
+	// Direct-form FIR of one input through two filters of the same length:
+	// left[i] += sum hL[k] * x[i - k] for k < taps, likewise right. x[1 - taps] must be readable.
+	void fir(const float* x, const float* hL, const float* hR, int taps, float* left, float* right, int n);
+
+	namespace Scalar
+	{
+		void blend3(const float* a, const float* b, const float* c, const float (&g)[3], float* out, int n);
+		void blend3(const int16_t* a, const int16_t* b, const int16_t* c, const float (&g)[3], float* out, int n);
+		void complexMultiply(const std::complex<float>* x, const std::complex<float>* h, float scale,
+			std::complex<float>* out, int n);
+		void complexMultiplyAdd(const std::complex<float>* x, const std::complex<float>* h, std::complex<float>* out, int n);
+		void crossfade(const std::complex<float>* current, const std::complex<float>* target, std::complex<float>* out, int n);
+		void fir(const float* x, const float* hL, const float* hR, int taps, float* left, float* right, int n);
+	}
+
+   #if VECTOROPS_X86
+	// The SSE2 and AVX versions, exposed so tools/VectorOpsCheck.cpp can compare them with Scalar
+	namespace Sse2
+	{
+		void blend3(const float* a, const float* b, const float* c, const float (&g)[3], float* out, int n);
+		void blend3(const int16_t* a, const int16_t* b, const int16_t* c, const float (&g)[3], float* out, int n);
+		void complexMultiply(const std::complex<float>* x, const std::complex<float>* h, float scale,
+			std::complex<float>* out, int n);
+		void complexMultiplyAdd(const std::complex<float>* x, const std::complex<float>* h, std::complex<float>* out, int n);
+		void crossfade(const std::complex<float>* current, const std::complex<float>* target, std::complex<float>* out, int n);
+		void fir(const float* x, const float* hL, const float* hR, int taps, float* left, float* right, int n);
+	}
+
+	// Only call these when isSupported(). There is no 16-bit blend3, see selectKernels() in VectorOps.cpp.
+	namespace Avx
+	{
+		bool isSupported();
+		void blend3(const float* a, const float* b, const float* c, const float (&g)[3], float* out, int n);
+		void complexMultiply(const std::complex<float>* x, const std::complex<float>* h, float scale,
+			std::complex<float>* out, int n);
+		void complexMultiplyAdd(const std::complex<float>* x, const std::complex<float>* h, std::complex<float>* out, int n);
+		void crossfade(const std::complex<float>* current, const std::complex<float>* target, std::complex<float>* out, int n);
+		void fir(const float* x, const float* hL, const float* hR, int taps, float* left, float* right, int n);
+	}
+   #endif
+}
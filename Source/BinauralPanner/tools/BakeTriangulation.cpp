@@ -0,0 +1,67 @@
+/*
+  ==============================================================================
+
+    BakeTriangulation.cpp
+
+    Offline generator for KemarTriangulation.h. The KEMAR grid never changes,
+    so its Delaunay triangulation is computed here once and compiled into the
+    plugin as constant data instead of being rebuilt at every instantiation.
+
+    Re-run whenever KemarGrid.h or the triangulation code changes:
+
+      c++ -std=c++11 -O2 -o bake BakeTriangulation.cpp ../delaunay/delaunay.cpp ../delaunay/triangle.cpp
+      ./bake > ../KemarTriangulation.h
+
+  ==============================================================================
+*/
+
+#include <cstdio>
+#include <vector>
+#include "../delaunay/delaunay.h"
+#include "../KemarGrid.h"
+
+int main()
+{
+	std::vector<Vec2f> points;
+	for (int vertex = 0; vertex < KemarGrid::numVertices; ++vertex)
+		points.push_back({static_cast<float>(KemarGrid::vertexAzimuth(vertex)), static_cast<float>(KemarGrid::vertexElevation(vertex))});
+
+	Delaunay triangulation;
+	triangulation.triangulate(points);
+	const auto& triangles = triangulation.getTriangles();
+
+	auto vertexIndex = [&](const Vec2f& p)
+	{
+		for (size_t i = 0; i < points.size(); ++i)
+			if (points[i] == p)
+				return static_cast<int>(i);
+		return -1;
+	};
+
+	printf("/*\n"
+		"    IMPORTANT! This file is auto-generated by tools/BakeTriangulation.cpp\n"
+		"    from KemarGrid.h - do not edit it by hand.\n"
+		"*/\n\n"
+		"#pragma once\n\n"
+		"namespace KemarTriangulation\n{\n"
+		"\tconst int numVertices = %d;\n"
+		"\tconst int numFaces = %d;\n\n",
+		KemarGrid::numVertices, static_cast<int>(triangles.size()));
+
+	printf("\t// Vertices A, B, C of each face, indexed as in KemarGrid\n"
+		"\tconst short faceVertices[numFaces][3] =\n\t{\n");
+	for (auto& t : triangles)
+		printf("\t\t{%d, %d, %d},\n", vertexIndex(t.p1), vertexIndex(t.p2), vertexIndex(t.p3));
+	printf("\t};\n\n");
+
+	printf("\t// Inverse of [A - C, B - C] for each face, column major\n"
+		"\tconst double faceInverseTransforms[numFaces][4] =\n\t{\n");
+	for (auto& t : triangles)
+	{
+		const double T[] = {t.p1.x - t.p3.x, t.p1.y - t.p3.y, t.p2.x - t.p3.x, t.p2.y - t.p3.y};
+		const auto det = T[0] * T[3] - T[1] * T[2];
+		printf("\t\t{%.17g, %.17g, %.17g, %.17g},\n", T[3] / det, -T[1] / det, -T[2] / det, T[0] / det);
+	}
+	printf("\t};\n}\n");
+	return 0;
+}
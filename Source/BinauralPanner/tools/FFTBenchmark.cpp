@@ -0,0 +1,87 @@
+/*
+  ==============================================================================
+
+    FFTBenchmark.cpp
+
+    Times a forward plus an inverse real transform with each FFT backend (see FFT.h)
+    at the sizes HRIRFilter, HRTFDatabase and MinimumPhase use, and checks that the
+    backends agree.
+
+      c++ -std=c++11 -O2 -o fftbenchmark FFTBenchmark.cpp ../FFT.cpp ../FloatFFT.cpp ../OouraFFT.cpp
+      ./fftbenchmark
+
+  ==============================================================================
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "../FFT.h"
+#include "../Util.h"
+
+namespace
+{
+	const FFT::Backend backends[] = {FFT::Backend::Ooura, FFT::Backend::Float};
+
+	// Microseconds per fft() + ifft() pair, best of several runs
+	double time(FFT& fft, const std::vector<float>& signal, int nfft)
+	{
+		std::vector<float> output(nfft);
+		ComplexVector<float> spectrum(nfft / 2 + 1);
+		const auto iterations = std::max(20, (1 << 22) / nfft);
+		auto best = 1e9;
+		for (auto run = 0; run < 5; ++run)
+		{
+			const auto start = std::chrono::steady_clock::now();
+			for (auto i = 0; i < iterations; ++i)
+			{
+				fft.fft(signal.data(), spectrum.data());
+				fft.ifft(spectrum.data(), output.data());
+			}
+			const auto elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start);
+			best = std::min(best, elapsed.count() / iterations);
+		}
+		return best;
+	}
+}
+
+int main()
+{
+	std::mt19937 random(1);
+	std::uniform_real_distribution<float> uniform(-1.f, 1.f);
+
+	printf("%6s", "nfft");
+	for (auto backend : backends)
+		printf(" %12s", FFT::getName(backend));
+	printf(" %10s %12s\n", "speedup", "max diff");
+
+	for (auto nfft = 128; nfft <= 8192; nfft *= 2)
+	{
+		std::vector<float> signal(nfft);
+		for (auto& x : signal)
+			x = uniform(random);
+
+		double times[2];
+		ComplexVector<float> spectra[2];
+		for (auto b = 0; b < 2; ++b)
+		{
+			auto fft = FFT::create(nfft, backends[b]);
+			times[b] = time(*fft, signal, nfft);
+			spectra[b].resize(nfft / 2 + 1);
+			fft->fft(signal.data(), spectra[b].data());
+		}
+
+		// Largest difference between the backends' spectra, relative to the largest bin
+		auto peak = 0.f, difference = 0.f;
+		for (auto k = 0; k <= nfft / 2; ++k)
+		{
+			peak = std::max(peak, std::abs(spectra[0][k]));
+			difference = std::max(difference, std::abs(spectra[0][k] - spectra[1][k]));
+		}
+
+		printf("%6d %9.2f us %9.2f us %9.2fx %12.2g\n", nfft, times[0], times[1], times[0] / times[1], difference / peak);
+	}
+	return 0;
+}
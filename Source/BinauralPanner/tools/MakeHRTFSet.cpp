@@ -0,0 +1,73 @@
+/*
+  ==============================================================================
+
+    MakeHRTFSet.cpp
+
+    Converts a headerless HRIR dump on the KEMAR grid (such as Resources/kemar.bin)
+    into an .hrtf file that HRTFDatabase can memory map. See HRTFFileFormat.h.
+
+      c++ -std=c++11 -O2 -o makehrtfset MakeHRTFSet.cpp
+      ./makehrtfset ../../../Resources/kemar.bin kemar.hrtf [sampleRate] [irLength]
+
+  ==============================================================================
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "../HRTFFileFormat.h"
+#include "../KemarGrid.h"
+
+int main(int argc, char* argv[])
+{
+	if (argc < 3)
+	{
+		fprintf(stderr, "usage: %s input.bin output.hrtf [sampleRate] [irLength]\n", argv[0]);
+		return 1;
+	}
+	const auto sampleRate = argc > 3 ? static_cast<float>(atof(argv[3])) : 44100.f;
+	const auto irLength = argc > 4 ? static_cast<uint32_t>(atoi(argv[4])) : 200u;
+
+	const auto numFloats = static_cast<size_t>(KemarGrid::numVertices) * 2 * irLength;
+	std::vector<float> irs(numFloats);
+	auto* in = fopen(argv[1], "rb");
+	if (in == nullptr || fread(irs.data(), sizeof(float), numFloats, in) != numFloats)
+	{
+		fprintf(stderr, "could not read %zu floats from %s\n", numFloats, argv[1]);
+		return 1;
+	}
+	fclose(in);
+
+	std::vector<float> grid;
+	for (auto i = 0; i < KemarGrid::numAzimuths; ++i)
+		grid.push_back(static_cast<float>(KemarGrid::azimuths[i]));
+	for (auto i = 0; i < KemarGrid::numElevations; ++i)
+		grid.push_back(static_cast<float>(KemarGrid::elevation(i)));
+
+	HRTFFileHeader header;
+	memcpy(header.magic, "HRTF", 4);
+	header.version = HRTFFileHeader::CURRENT_VERSION;
+	header.sampleRate = sampleRate;
+	header.irLength = irLength;
+	header.numEars = 2;
+	header.earLayout = HRTFFileHeader::kEarsPerMeasurement;
+	header.numAzimuths = KemarGrid::numAzimuths;
+	header.numElevations = KemarGrid::numElevations;
+	const auto unpadded = sizeof(header) + grid.size() * sizeof(float);
+	header.headerSize = static_cast<uint32_t>((unpadded + 15) & ~static_cast<size_t>(15));
+
+	auto* out = fopen(argv[2], "wb");
+	if (out == nullptr)
+	{
+		fprintf(stderr, "could not open %s\n", argv[2]);
+		return 1;
+	}
+	const std::vector<char> padding(header.headerSize - unpadded, 0);
+	fwrite(&header, sizeof(header), 1, out);
+	fwrite(grid.data(), sizeof(float), grid.size(), out);
+	fwrite(padding.data(), 1, padding.size(), out);
+	fwrite(irs.data(), sizeof(float), irs.size(), out);
+	fclose(out);
+	return 0;
+}
@@ -0,0 +1,156 @@
+/*
+  ==============================================================================
+
+    MixerBenchmark.cpp
+
+    Times the three ways of rendering several sources binaurally, for 1, 8 and 32
+    sources at 44.1 kHz in 128-sample blocks: one BinauralPanner per source, one
+    BinauralMixer, and an AmbisonicsMixer at first and third order. Also times a
+    third-order scene whose rotation changes every block, and the third-order
+    decoder fit done in prepareToPlay().
+
+    Unlike the other tools this one needs JUCE: build it against the plugin's
+    JuceLibraryCode, with the BinaryData.cpp the Projucer generates for the
+    built-in HRTF set, and JUCE set to the checkout the .jucer points at.
+
+      c++ -std=c++11 -O2 -DNDEBUG -I../../../JuceLibraryCode -I$JUCE/modules -I../triangle++/include \
+        -o mixerbenchmark MixerBenchmark.cpp ../BinauralPanner.cpp ../BinauralMixer.cpp ../AmbisonicsMixer.cpp \
+        ../SphericalHarmonics.cpp ../HRTFContainer.cpp ../HRTFDatabase.cpp ../HRIRFilter.cpp ../FractionalDelay.cpp \
+        ../MinimumPhase.cpp ../VectorOps.cpp ../FFT.cpp ../FloatFFT.cpp ../OouraFFT.cpp ../delaunay/delaunay.cpp ../delaunay/triangle.cpp \
+        ../../../JuceLibraryCode/juce_core.cpp ../../../JuceLibraryCode/juce_events.cpp \
+        ../../../JuceLibraryCode/juce_audio_basics.cpp ../../../JuceLibraryCode/juce_audio_formats.cpp \
+        ../../../JuceLibraryCode/juce_data_structures.cpp ../../../JuceLibraryCode/BinaryData.cpp -lpthread -ldl
+      ./mixerbenchmark
+
+  ==============================================================================
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <vector>
+#include "../BinauralPanner.h"
+#include "../BinauralMixer.h"
+#include "../AmbisonicsMixer.h"
+
+namespace
+{
+	const double sampleRate = 44100.;
+	const int blockSize = 128;
+
+	// Microseconds per block of process(), best of several runs
+	template <typename Process>
+	double time(Process process, int iterations)
+	{
+		auto best = 1e9;
+		for (auto run = 0; run < 5; ++run)
+		{
+			const auto start = std::chrono::steady_clock::now();
+			for (auto i = 0; i < iterations; ++i)
+				process(i);
+			const auto elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start);
+			best = std::min(best, elapsed.count() / iterations);
+		}
+		return best;
+	}
+
+	// Sources spread 11 degrees apart on the horizontal plane, split at the plugin's crossover
+	template <typename Mixer>
+	void prepareMixer(Mixer& mixer, int numSources)
+	{
+		mixer.setNumSources(numSources);
+		for (auto s = 0; s < numSources; ++s)
+			mixer.setPosition(s, 11.f * s, 0.f);
+		mixer.prepareToPlay(sampleRate, blockSize);
+		mixer.setCrossoverFreq(150.f);
+	}
+
+	void copy(const AudioSampleBuffer& source, AudioSampleBuffer& destination)
+	{
+		for (auto c = 0; c < source.getNumChannels(); ++c)
+			destination.copyFrom(c, 0, source, c, 0, blockSize);
+	}
+
+	template <typename Mixer>
+	double timeMixer(Mixer& mixer, const AudioSampleBuffer& input, AudioSampleBuffer& work, int iterations)
+	{
+		return time([&](int) { copy(input, work); mixer.processBlock(work); }, iterations);
+	}
+}
+
+int main()
+{
+	std::mt19937 random(1);
+	std::uniform_real_distribution<float> uniform(-1.f, 1.f);
+
+	printf("%7s %12s %14s %12s %12s   (us per %d samples)\n", "sources", "panners", "BinauralMixer",
+		"1st order", "3rd order", blockSize);
+
+	for (auto numSources : {1, 8, 32})
+	{
+		std::vector<std::unique_ptr<BinauralPanner>> panners;
+		for (auto s = 0; s < numSources; ++s)
+		{
+			panners.emplace_back(new BinauralPanner);
+			panners[s]->setAzimuth(11.f * s);
+			panners[s]->prepareToPlay(sampleRate, blockSize);
+			panners[s]->setCrossoverFreq(150.f);
+		}
+		BinauralMixer binauralMixer;
+		AmbisonicsMixer firstOrder, thirdOrder;
+		firstOrder.setOrder(1);
+		thirdOrder.setOrder(3);
+		prepareMixer(binauralMixer, numSources);
+		prepareMixer(firstOrder, numSources);
+		prepareMixer(thirdOrder, numSources);
+
+		// The mixers need at least the two output channels
+		const auto numChannels = std::max(2, numSources);
+		AudioSampleBuffer input(numChannels, blockSize), work(numChannels, blockSize), stereo(2, blockSize);
+		for (auto c = 0; c < numChannels; ++c)
+			for (auto i = 0; i < blockSize; ++i)
+				input.setSample(c, i, uniform(random));
+
+		const auto iterations = 40000 / numSources + 200;
+		const auto pannerTime = time([&](int) {
+			for (auto s = 0; s < numSources; ++s)
+			{
+				stereo.copyFrom(0, 0, input, s, 0, blockSize);
+				panners[s]->processBlock(stereo, 0);
+			}
+		}, iterations);
+		printf("%7d %12.1f %14.1f %12.1f %12.1f\n", numSources, pannerTime,
+			timeMixer(binauralMixer, input, work, iterations), timeMixer(firstOrder, input, work, iterations),
+			timeMixer(thirdOrder, input, work, iterations));
+	}
+
+	{
+		const auto numSources = 8;
+		AmbisonicsMixer mixer;
+		mixer.setOrder(3);
+		prepareMixer(mixer, numSources);
+		AudioSampleBuffer input(numSources, blockSize), work(numSources, blockSize);
+		for (auto c = 0; c < numSources; ++c)
+			for (auto i = 0; i < blockSize; ++i)
+				input.setSample(c, i, uniform(random));
+
+		const auto rotating = time([&](int i) {
+			mixer.setSceneRotation(0.5f * i, 5.f, 0.f);
+			copy(input, work);
+			mixer.processBlock(work);
+		}, 2000);
+		printf("3rd order, %d sources, rotation changing every block: %.1f us\n", numSources, rotating);
+	}
+
+	const auto start = std::chrono::steady_clock::now();
+	{
+		AmbisonicsMixer mixer;
+		mixer.setOrder(3);
+		mixer.prepareToPlay(sampleRate, blockSize);
+	}
+	printf("3rd order prepareToPlay(): %.1f ms\n",
+		std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+	return 0;
+}
@@ -0,0 +1,179 @@
+/*
+  ==============================================================================
+
+    StorageAccuracy.cpp
+
+    Reports how much 16-bit compact storage (HRTFDatabase::LoadOptions::compactStorage,
+    ConvolutionReverb::setCompactIRStorage()) changes the responses the plugin renders.
+    The HRTF side loads the built-in set twice with the panner's options, float and
+    compact, and compares interpolateHRIR() every 2 degrees over the triangulation.
+    The reverb side runs the embedded IRs, and any .wav files given, through
+    CompactStorage as ConvolutionReverb does. Each response's magnitude is compared
+    with the float one, ignoring bins more than 60 dB below its peak.
+
+    Like MixerBenchmark.cpp this needs JUCE: build it against the plugin's
+    JuceLibraryCode, with the BinaryData.cpp the Projucer generates, and JUCE set
+    to the checkout the .jucer points at.
+
+      c++ -std=c++11 -O2 -DNDEBUG -I../../../JuceLibraryCode -I$JUCE/modules -I../triangle++/include \
+        -o storageaccuracy StorageAccuracy.cpp ../HRTFDatabase.cpp ../MinimumPhase.cpp ../VectorOps.cpp \
+        ../FFT.cpp ../FloatFFT.cpp ../OouraFFT.cpp ../delaunay/delaunay.cpp ../delaunay/triangle.cpp \
+        ../../../JuceLibraryCode/juce_core.cpp ../../../JuceLibraryCode/juce_events.cpp \
+        ../../../JuceLibraryCode/juce_audio_basics.cpp ../../../JuceLibraryCode/juce_audio_formats.cpp \
+        ../../../JuceLibraryCode/juce_data_structures.cpp ../../../JuceLibraryCode/BinaryData.cpp -lpthread -ldl
+      ./storageaccuracy [ir.wav ...]
+
+  ==============================================================================
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+#include "../BinauralPanner.h"
+#include "../CompactStorage.h"
+#include "../OouraFFT.h"
+
+namespace
+{
+	const double RANGE_DB = 60.;
+	const double GRID_STEP = 2.; // degrees
+
+	struct Deviation
+	{
+		double maxDB = 0.;
+		double worstSNR = 1e9;
+		float maxDelayError = 0.f;
+	};
+
+	void compare(const float* reference, const float* quantised, int length, Deviation& deviation)
+	{
+		const auto fftSize = 2 * nextPowerOf2(length);
+		OouraFFT fft;
+		fft.init(fftSize);
+		std::vector<float> buffer(fftSize);
+		ComplexVector<float> a(fftSize / 2 + 1), b(fftSize / 2 + 1);
+
+		std::copy(reference, reference + length, buffer.begin());
+		std::fill(buffer.begin() + length, buffer.end(), 0.f);
+		fft.fft(buffer.data(), a.data());
+		std::copy(quantised, quantised + length, buffer.begin());
+		fft.fft(buffer.data(), b.data());
+
+		auto peak = 0.;
+		for (auto& bin : a)
+			peak = std::max(peak, static_cast<double>(std::abs(bin)));
+		const auto floor = peak * std::pow(10., -RANGE_DB / 20.);
+		for (size_t i = 0; i < a.size(); ++i)
+		{
+			if (std::abs(a[i]) < floor)
+				continue;
+			const auto dB = 20. * std::log10(std::abs(b[i]) / std::abs(a[i]));
+			deviation.maxDB = std::max(deviation.maxDB, std::abs(dB));
+		}
+
+		auto signal = 0., noise = 0.;
+		for (auto i = 0; i < length; ++i)
+		{
+			signal += reference[i] * reference[i];
+			noise += (reference[i] - quantised[i]) * (reference[i] - quantised[i]);
+		}
+		if (noise > 0.)
+			deviation.worstSNR = std::min(deviation.worstSNR, 10. * std::log10(signal / noise));
+	}
+
+	// Quantises and expands each channel as ConvolutionReverb::readIR() and createEngine() do
+	void compareChannels(const AudioSampleBuffer& ir, Deviation& deviation)
+	{
+		const auto length = ir.getNumSamples();
+		std::vector<int16_t> compact(length);
+		std::vector<float> expanded(length);
+		for (auto chan = 0; chan < ir.getNumChannels(); ++chan)
+		{
+			const auto scale = CompactStorage::quantise(ir.getReadPointer(chan), compact.data(), length);
+			CompactStorage::expand(compact.data(), scale, expanded.data(), length);
+			compare(ir.getReadPointer(chan), expanded.data(), length, deviation);
+		}
+	}
+
+	bool readWav(InputStream* stream, AudioSampleBuffer& ir)
+	{
+		WavAudioFormat wavFormat;
+		ScopedPointer<AudioFormatReader> reader(wavFormat.createReaderFor(stream, true));
+		if (reader == nullptr)
+			return false;
+		ir.setSize(jmax(1, static_cast<int>(reader->numChannels)), static_cast<int>(reader->lengthInSamples));
+		reader->read(&ir, 0, ir.getNumSamples(), 0, true, true);
+		return true;
+	}
+
+	void printDeviation(const char* name, const Deviation& deviation)
+	{
+		printf("%-40s max %.3f dB, worst SNR %.1f dB\n", name, deviation.maxDB, deviation.worstSNR);
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	// The set the panners render with, and the same set stored compactly
+	SharedResourcePointer<HRTFDatabase::Library> library;
+	HRTFDatabase::LoadOptions options;
+	options.minimumPhaseTaps = BinauralPanner::cMinimumPhaseTaps;
+	const auto reference = library->getDefault(options);
+	options.compactStorage = true;
+	const auto compact = library->getDefault(options);
+
+	HRIRBuffer a, b;
+	a.setSize(reference->getIRLength());
+	b.setSize(compact->getIRLength());
+
+	Deviation hrirDeviation;
+	auto numPoints = 0;
+	for (auto azimuth = -90.; azimuth <= 90.; azimuth += GRID_STEP)
+	{
+		for (auto elevation = -90.; elevation <= 270.; elevation += GRID_STEP)
+		{
+			if (!reference->interpolateHRIR(azimuth, elevation, a) || !compact->interpolateHRIR(azimuth, elevation, b))
+				continue;
+			compare(a.leftEarIR.data(), b.leftEarIR.data(), reference->getIRLength(), hrirDeviation);
+			compare(a.rightEarIR.data(), b.rightEarIR.data(), reference->getIRLength(), hrirDeviation);
+			hrirDeviation.maxDelayError = std::max(hrirDeviation.maxDelayError, std::max(std::abs(a.leftEarDelay - b.leftEarDelay),
+				std::abs(a.rightEarDelay - b.rightEarDelay)));
+			++numPoints;
+		}
+	}
+	printf("%-40s max %.3f dB, worst SNR %.1f dB, delays within %.2g samples (%d positions, %d taps)\n", "built-in HRTF set",
+		hrirDeviation.maxDB, hrirDeviation.worstSNR, hrirDeviation.maxDelayError, numPoints, reference->getIRLength());
+
+	for (auto i = 0; i < BinaryData::namedResourceListSize; ++i)
+	{
+		const String name(BinaryData::namedResourceList[i]);
+		if (!name.endsWith("_wav"))
+			continue;
+
+		int size = 0;
+		const auto* data = BinaryData::getNamedResource(BinaryData::namedResourceList[i], size);
+		AudioSampleBuffer ir;
+		if (!readWav(new MemoryInputStream(data, static_cast<size_t>(size), false), ir))
+			continue;
+
+		Deviation deviation;
+		compareChannels(ir, deviation);
+		printDeviation(BinaryData::namedResourceList[i], deviation);
+	}
+
+	for (auto arg = 1; arg < argc; ++arg)
+	{
+		AudioSampleBuffer ir;
+		if (!readWav(new FileInputStream(File::getCurrentWorkingDirectory().getChildFile(argv[arg])), ir))
+		{
+			fprintf(stderr, "can't read %s\n", argv[arg]);
+			return 1;
+		}
+
+		Deviation deviation;
+		compareChannels(ir, deviation);
+		printDeviation(argv[arg], deviation);
+	}
+	return 0;
+}
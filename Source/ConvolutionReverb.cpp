@@ -8,17 +8,30 @@
 */
 
 #include "ConvolutionReverb.h"
+#include "BinauralPanner/CompactStorage.h"
 
 ConvolutionReverb::ConvolutionReverb()
 : Thread("ConvolutionReverb Sample Loading Thread")
 , mSampleRate(0.)
-, mIRSampleRate(44100.)
+, mBlockSize(0)
+, mTailEngine(nullptr)
+, mFadingTailEngine(nullptr)
+, mTailThread("ConvolutionReverb Tail Thread")
+, mNumLateTailBlocks(0)
+, mIRNumChannels(0)
+, mIRNumSamples(0)
 , mLoadThreadToAudioThreadCallQueue(1024)
+, mAudioThreadToLoadThreadCallQueue(1024)
 , mDryLevel(1.)
 , mWetLevel(1.)
-, mImpulseLoaded(false)
+, mCrossfadeTime(cDefaultCrossfadeTime)
+, mFadePosition(0)
+, mFadeLength(1)
+, mFadeOutStart(1.f)
+, mCompactIRStorage(false)
+, mBackgroundTail(false)
+, mMonoInput(false)
 {
-  //mEngine.EnableThread(true);
 }
 
 ConvolutionReverb::~ConvolutionReverb()
@@ -27,18 +40,41 @@ ConvolutionReverb::~ConvolutionReverb()
   {
     stopThread(-1);
   }
+  
+  mTailThread.removeTimeSliceClient(this);
+  mTailThread.stopThread(1000);
+  
+  // Nothing is processing any more: take any engine still waiting in the queue, then free the old ones
+  mLoadThreadToAudioThreadCallQueue.synchronize();
+  deleteRetiredEngines();
 }
 
 void ConvolutionReverb::prepareToPlay (double sampleRate, int estimatedSamplesPerBlock)
 {
+  mDownmix.setSize(1, estimatedSamplesPerBlock);
+  mCrossfadeBuffer.setSize(2, estimatedSamplesPerBlock);
+  
+  const bool rateChanged = sampleRate != mSampleRate;
+  // The background tail's deadline is sized to the block size
+  const bool blockSizeChanged = mBackgroundTail && estimatedSamplesPerBlock != mBlockSize;
+  
   // Detect a change in sample rate.
-  if (sampleRate != mSampleRate)
+  if (rateChanged || blockSizeChanged)
   {
-    mSampleRate = sampleRate;
+    // A load in progress would build its engine for the old rate: let it finish reading, then build here
+    signalThreadShouldExit();
+    waitForThreadToExit(-1);
+    deleteRetiredEngines();
     
-    if(mIRAudioSampleBuffer != nullptr)
-      updateConvoEngineIR(mIRAudioSampleBuffer->getNumChannels(), mIRSampleRate);
+    mSampleRate = sampleRate;
+    mBlockSize = estimatedSamplesPerBlock;
     
+    if(mIRNumSamples > 0)
+      postEngine(createEngine(mMonoInput));
+  }
+  
+  if (rateChanged)
+  {
     mDryLevelSmoother.setTimeMS(cSmoothTime, mSampleRate);
     mWetLevelSmoother.setTimeMS(cSmoothTime, mSampleRate);
   }
@@ -46,15 +82,58 @@ void ConvolutionReverb::prepareToPlay (double sampleRate, int estimatedSamplesPe
 
 void ConvolutionReverb::processBlock(AudioBuffer<float> &buffer, MidiBuffer &midiMessages)
 {
-  mLoadThreadToAudioThreadCallQueue.synchronize(); // will update IR if changed
+  processBlock(buffer, nullptr, midiMessages);
+}
+
+void ConvolutionReverb::processBlock(AudioBuffer<float> &buffer, const float* monoInput, MidiBuffer &midiMessages)
+{
+  mLoadThreadToAudioThreadCallQueue.synchronize(); // swaps in a new engine if one was built
   
   const int numSamples = buffer.getNumSamples();
+  int nAvail = 0;
+  
+  // A mono engine given stereo, until the engine for it is built
+  const bool needsDownmix = monoInput == nullptr
+    && ((mEngine != nullptr && mEngine->numChannels == 1) || (mFadingEngine != nullptr && mFadingEngine->numChannels == 1));
+  
+  if(needsDownmix)
+  {
+    mDownmix.setSize(1, numSamples, false, false, true);
+    mDownmix.copyFrom(0, 0, buffer.getReadPointer(0), numSamples, 0.5f);
+    mDownmix.addFrom(0, 0, buffer, 1, 0, numSamples, 0.5f);
+  }
   
   // Send input samples to the convolution engine.
-  if(mImpulseLoaded)
-    mEngine.Add(buffer.getArrayOfWritePointers(), numSamples, 2);
+  if(mEngine != nullptr)
+  {
+    addInput(*mEngine, buffer, monoInput);
+    nAvail = std::min(mEngine->engine.Avail(numSamples), numSamples);
+  }
   
-  int nAvail = std::min(mEngine.Avail( numSamples),  numSamples);
+  // The engine being faded out keeps running on the same input
+  if(mFadingEngine != nullptr)
+    addInput(*mFadingEngine, buffer, monoInput);
+  
+  if(nAvail > 0 && mEngine->tailOffset > 0)
+    mixTail(*mEngine, mEngine->engine.Get(), nAvail);
+  
+  // The wet signal comes out at the end of the block
+  int wetAvail = nAvail;
+  const WDL_FFT_REAL* convo1 = nullptr;
+  const WDL_FFT_REAL* convo2 = nullptr;
+  
+  if(mFadingEngine != nullptr)
+  {
+    mCrossfadeBuffer.setSize(2, numSamples, false, false, true);
+    wetAvail = crossfadeEngines(numSamples, nAvail);
+    convo1 = mCrossfadeBuffer.getReadPointer(0);
+    convo2 = mCrossfadeBuffer.getReadPointer(1);
+  }
+  else if(nAvail > 0)
+  {
+    convo1 = mEngine->engine.Get()[0];
+    convo2 = mEngine->engine.Get()[mEngine->numChannels - 1];
+  }
   
   const float* in1 = buffer.getReadPointer(0);
   const float* in2 = buffer.getReadPointer(1);
@@ -64,7 +143,7 @@ void ConvolutionReverb::processBlock(AudioBuffer<float> &buffer, MidiBuffer &mid
   
   // If not enough samples are available yet, then only output the dry
   // signal.
-  for (int i = 0; i < numSamples - nAvail; ++i)
+  for (int i = 0; i < numSamples - wetAvail; ++i)
   {
     const float smoothedDryLevel = mDryLevelSmoother.process(mDryLevel);
     
@@ -73,33 +152,28 @@ void ConvolutionReverb::processBlock(AudioBuffer<float> &buffer, MidiBuffer &mid
   }
   
   // Output samples from the convolution engine.
-  if (nAvail > 0)
+  for (int i = 0; i < wetAvail; ++i)
   {
-    WDL_FFT_REAL* convo1 = mEngine.Get()[0];
-    WDL_FFT_REAL* convo2 = mEngine.Get()[1];
-    
-    for (int i = 0; i < nAvail; ++i)
-    {
-      const float smoothedDryLevel = mDryLevelSmoother.process(mDryLevel);
-      const float smoothedWetLevel = mWetLevelSmoother.process(mWetLevel);
-      
-      *out1++ = smoothedDryLevel * *in1++ + smoothedWetLevel * *convo1++;
-      *out2++ = smoothedDryLevel * *in2++ + smoothedWetLevel * *convo2++;
-    }
+    const float smoothedDryLevel = mDryLevelSmoother.process(mDryLevel);
+    const float smoothedWetLevel = mWetLevelSmoother.process(mWetLevel);
     
-    // Remove the sample block from the convolution engine's buffer.
-    mEngine.Advance(nAvail);
+    *out1++ = smoothedDryLevel * *in1++ + smoothedWetLevel * *convo1++;
+    *out2++ = smoothedDryLevel * *in2++ + smoothedWetLevel * *convo2++;
   }
+  
+  // Remove the sample block from the convolution engine's buffer.
+  if (nAvail > 0)
+    mEngine->engine.Advance(nAvail);
 }
 
 template <class I, class O>
-void ConvolutionReverb::resampleIR(const I* src, int srcLen, double srcRate, O* dest, int destLen, double destRate)
+void ConvolutionReverb::resampleIR(r8b::CDSPResampler16IR& resampler, const I* src, int srcLen, double srcRate, O* dest, int destLen, double destRate, double srcScale) const
 {
   if (destLen == srcLen)
   {
     // Copy
     for (int i = 0; i < destLen; ++i)
-      *dest++ = (O)*src++;
+      *dest++ = (O)(srcScale * *src++);
     
     return;
   }
@@ -115,14 +189,14 @@ void ConvolutionReverb::resampleIR(const I* src, int srcLen, double srcRate, O*
       n = srcLen;
     
     for (int i = 0; i < n; ++i)
-      *p++ = (double)*src++;
+      *p++ = srcScale * (double)*src++;
     
     if (n < cBlockLength)
       memset(p, 0, (cBlockLength - n) * sizeof(double));
     
     srcLen -= n;
     
-    n = mResampler->process(buf, cBlockLength, p);
+    n = resampler.process(buf, cBlockLength, p);
     
     if (n > destLen)
       n = destLen;
@@ -133,40 +207,44 @@ void ConvolutionReverb::resampleIR(const I* src, int srcLen, double srcRate, O*
     destLen -= n;
   }
   
-  mResampler->clear();
+  resampler.clear();
 }
 
 void ConvolutionReverb::run()
 {
+  deleteRetiredEngines();
+  
   if(mSourceData != nullptr)
   {
-    WavAudioFormat wavFormat;
-    
-    ScopedPointer<AudioFormatReader> audioReader (wavFormat.createReaderFor (new MemoryInputStream(mSourceData, mSourceDataSize, false), true));
-    
-    mIRAudioSampleBuffer = new AudioSampleBuffer (jmax (1, (int) audioReader->numChannels), audioReader->lengthInSamples);
-    
-    audioReader->read (mIRAudioSampleBuffer, 0, audioReader->lengthInSamples, 0, true, true);
-    
-    mLoadThreadToAudioThreadCallQueue.callf(std::bind(&ConvolutionReverb::updateConvoEngineIR, this, audioReader->numChannels, audioReader->sampleRate));
+    // Embedded IRs stay at the same address for the life of the process
+    readIR("memory:" + String::toHexString((pointer_sized_int) mSourceData) + ":" + String((int64) mSourceDataSize),
+           new MemoryInputStream(mSourceData, mSourceDataSize, false));
     
     mSourceData = nullptr;
     mSourceDataSize = 0;
   }
     if(mFile.exists())
   {
-    WavAudioFormat wavFormat;
-
-    ScopedPointer<AudioFormatReader> audioReader (wavFormat.createReaderFor (new FileInputStream(mFile), true));
-
-    mIRAudioSampleBuffer = new AudioSampleBuffer (jmax (1, (int) audioReader->numChannels), audioReader->lengthInSamples);
-
-    audioReader->read (mIRAudioSampleBuffer, 0, audioReader->lengthInSamples, 0, true, true);
-    
-    mLoadThreadToAudioThreadCallQueue.callf(std::bind(&ConvolutionReverb::updateConvoEngineIR, this, audioReader->numChannels, audioReader->sampleRate));
+    readIR(mFile.getFullPathName() + ":" + String(mFile.getLastModificationTime().toMilliseconds()), new FileInputStream(mFile));
   }
   else
     mFile = File::nonexistent;
+  
+  // Before prepareToPlay() there is no rate to build for, it builds the engine itself, as it does when
+  // it stops the thread for a new rate. Started with nothing new to load, rebuilds the current IR, see
+  // setMonoInput().
+  if(mIRNumSamples == 0 || mSampleRate <= 0. || threadShouldExit())
+    return;
+  
+  bool monoInput;
+  
+  do
+  {
+    monoInput = mMonoInput;
+    postEngine(createEngine(monoInput));
+  }
+  // setMonoInput() can't restart the thread while it is running, so pick up a change made during the build here
+  while (monoInput != mMonoInput && mIRNumChannels == 1 && !threadShouldExit());
 }
 
 void ConvolutionReverb::loadNewIRAsync(File& audioFile)
@@ -189,25 +267,456 @@ void ConvolutionReverb::loadNewIRFromMemoryAsync(const void* sourceData, size_t
   startThread();
 }
 
-void ConvolutionReverb::updateConvoEngineIR(int numChans, double IRSampleRate)
+void ConvolutionReverb::readIR(const String& source, InputStream* stream)
+{
+  ScopedPointer<InputStream> input (stream);
+  
+  DecodedIR::Ptr decoded = mIRLibrary->getDecoded(source, mCompactIRStorage, [&input] (DecodedIR& ir)
+  {
+    WavAudioFormat wavFormat;
+    
+    ScopedPointer<AudioFormatReader> reader (wavFormat.createReaderFor (input.release(), true));
+    
+    if(reader == nullptr)
+      return;
+    
+    ir.sampleRate = reader->sampleRate;
+    ir.numChannels = jmax (1, (int) reader->numChannels);
+    ir.numSamples = (int) reader->lengthInSamples;
+    ir.samples.setSize(ir.numChannels, ir.numSamples);
+    
+    reader->read (&ir.samples, 0, ir.numSamples, 0, true, true);
+  });
+  
+  if(decoded->numSamples == 0)
+    return;
+  
+  mDecodedIR = decoded;
+  mIRNumChannels = decoded->numChannels;
+  mIRNumSamples = decoded->numSamples;
+}
+
+ConvolutionReverb::Engine::Engine(int offset, int channels)
+: numChannels(channels)
+, tailOffset(offset)
+// Room for a few deadlines' worth either way
+, tailInputFifo(jmax(1, 4 * offset))
+, tailOutputFifo(jmax(1, 4 * offset))
+, tailInput(channels, 4 * offset)
+, tailOutput(channels, 4 * offset)
+, tailSamplesToSkip(0)
+{
+  tailOutput.clear();
+}
+
+ConvolutionReverb::Engine* ConvolutionReverb::createEngine(bool monoInput) const
+{
+  const DecodedIR::Ptr decoded = mDecodedIR;
+  const int resampledLength = calcResampleLength(decoded->numSamples, decoded->sampleRate, mSampleRate);
+  
+  // The head, convolved in the callback, covers the first few partitions and at least a few blocks,
+  // which gives the tail thread that long to deliver. Only worth it if the tail is longer.
+  int tailOffset = jmax(cMinTailOffset, 4 * nextPowerOfTwo(mBlockSize));
+  if (!mBackgroundTail || resampledLength <= 2 * tailOffset)
+    tailOffset = 0;
+  
+  // A mono IR fed mono needs only the one convolution, copied to both sides
+  const int numChannels = monoInput && decoded->numChannels == 1 ? 1 : 2;
+  
+  ScopedPointer<Engine> engine = new Engine(tailOffset, numChannels);
+  
+  const IRLibrary::Key key = { decoded->source, decoded->numChannels, mSampleRate, decoded->isCompact() };
+  
+  engine->ir = mIRLibrary->get(key, [this, decoded, resampledLength] (ResampledIR& resampled)
+  {
+    WDL_ImpulseBuffer& ir = resampled.ir;
+    ir.SetNumChannels(decoded->numChannels);
+    
+    r8b::CDSPResampler16IR resampler(decoded->sampleRate, mSampleRate, cBlockLength);
+    
+    // Resample the impulse response.
+    int impulseLength = ir.SetLength(resampledLength);
+    
+    if (impulseLength)
+    {
+      for(auto chan=0;chan<decoded->numChannels;chan++)
+      {
+        if(!decoded->isCompact())
+          resampleIR(resampler, decoded->samples.getReadPointer(chan), decoded->numSamples, decoded->sampleRate, ir.impulses[chan].Get(), impulseLength, mSampleRate);
+        else
+          resampleIR(resampler, decoded->compactSamples + chan * decoded->numSamples, decoded->numSamples, decoded->sampleRate, ir.impulses[chan].Get(), impulseLength, mSampleRate, decoded->compactScales[chan]);
+      }
+    }
+  });
+  
+  // Tie the impulse response to the convolution engine, which partitions and transforms it.
+  WDL_ImpulseBuffer* ir = &engine->ir->ir;
+  
+  if (tailOffset > 0)
+  {
+    // SetImpulse(impulse, maxfft_size, known_blocksize, max_imp_size): 0 leaves WDL's own FFT sizes. WDL
+    // only runs the head. The tail's partitions are half the deadline, which leaves the tail thread the
+    // other half, and its output is primed with just that much silence to make up the delay.
+    // tools/TailSplitCheck.cpp checks the split against a single engine.
+    engine->engine.SetImpulse(ir, 0, 0, tailOffset);
+    engine->tail.prepare(engine->ir->getTailSpectra(tailOffset, tailOffset / 2), numChannels);
+    engine->tailOutputFifo.finishedWrite(tailOffset - engine->tail.getLatency());
+  }
+  else
+    engine->engine.SetImpulse(ir);
+  
+  return engine.release();
+}
+
+std::shared_ptr<const PartitionedConvolver::Spectra> ConvolutionReverb::ResampledIR::getTailSpectra(int tailOffset, int partitionSize)
+{
+  const ScopedLock sl(tailSpectraLock);
+  
+  auto& cached = tailSpectra[std::make_pair(tailOffset, partitionSize)];
+  if (auto spectra = cached.lock())
+    return spectra;
+  
+  const float* tails[2];
+  const int numChannels = jmin(ir.GetNumChannels(), 2);
+  for (int chan = 0; chan < numChannels; ++chan)
+    tails[chan] = ir.impulses[chan].Get() + tailOffset;
+  
+  auto spectra = PartitionedConvolver::createSpectra(tails, numChannels, ir.GetLength() - tailOffset, partitionSize);
+  cached = spectra;
+  return spectra;
+}
+
+template <class ItemKey, class Item>
+ReferenceCountedObjectPtr<Item> ConvolutionReverb::IRLibrary::getItem(std::map<ItemKey, ReferenceCountedObjectPtr<Item>>& items, const ItemKey& key, std::function<void(Item&)> build)
+{
+  ReferenceCountedObjectPtr<Item> item;
+  bool claimed = false;
+  
+  {
+    const ScopedLock sl(mLock);
+    
+    auto found = items.find(key);
+    item = found != items.end() ? found->second : nullptr;
+    
+    // Let go of the items nothing uses any more. One still being built is held by its builder.
+    for (auto it = items.begin(); it != items.end();)
+    {
+      if (it->second->getReferenceCount() == 1)
+        it = items.erase(it);
+      else
+        ++it;
+    }
+    
+    // Claim the key with an empty entry, so that the item is only built once
+    if (item == nullptr)
+    {
+      item = new Item;
+      items[key] = item;
+      claimed = true;
+    }
+  }
+  
+  if (claimed)
+  {
+    build(*item);
+    item->built.signal();
+  }
+  else
+    item->built.wait();
+  
+  return item;
+}
+
+ConvolutionReverb::ResampledIR::Ptr ConvolutionReverb::IRLibrary::get(const Key& key, std::function<void(ResampledIR&)> resample)
+{
+  return getItem(mIRs, key, resample);
+}
+
+ConvolutionReverb::DecodedIR::Ptr ConvolutionReverb::IRLibrary::getDecoded(const String& source, bool compact, std::function<void(DecodedIR&)> read)
+{
+  return getItem(mDecodedIRs, std::make_pair(source, compact), std::function<void(DecodedIR&)>([&read, &source, compact] (DecodedIR& ir)
+  {
+    ir.source = source;
+    read(ir);
+    
+    if(!compact || ir.numSamples == 0)
+      return;
+    
+    // quantise to 16 bits, using the whole range for each channel's peak
+    ir.compactSamples.malloc((size_t) (ir.numChannels * ir.numSamples));
+    ir.compactScales.malloc((size_t) ir.numChannels);
+    
+    for(auto chan=0;chan<ir.numChannels;chan++)
+      ir.compactScales[chan] = CompactStorage::quantise(ir.samples.getReadPointer(chan), ir.compactSamples + chan * ir.numSamples, ir.numSamples);
+    
+    ir.samples.setSize(0, 0);
+  }));
+}
+
+void ConvolutionReverb::postEngine(Engine* engine)
+{
+  // The tail thread starts with the first engine: besides the tails, it frees the engines swapped out, which
+  // only retire once their crossfade is over
+  if(!mTailThread.isThreadRunning())
+  {
+    mTailThread.addTimeSliceClient(this);
+    mTailThread.startThread(8);
+  }
+  
+  if(!mLoadThreadToAudioThreadCallQueue.callf(std::bind(&ConvolutionReverb::swapEngine, this, engine)))
+    delete engine;
+}
+
+void ConvolutionReverb::swapEngine(Engine* engine)
+{
+  // A switch during a crossfade cuts the oldest engine, and fades the one that was coming in out from
+  // where it had got to
+  Engine* oldestEngine = mFadingEngine.release();
+  const float fadeOutStart = oldestEngine != nullptr ? getFadeInGain(mFadePosition) : 1.f;
+  
+  Engine* oldEngine = mEngine.release();
+  mEngine = engine;
+  
+  if(oldEngine != nullptr && mCrossfadeTime > 0.f)
+  {
+    mFadingEngine = oldEngine;
+    oldEngine = nullptr;
+    mFadePosition = 0;
+    mFadeLength = jmax(1, roundToInt(mCrossfadeTime * 0.001 * mSampleRate));
+    mFadeOutStart = fadeOutStart;
+  }
+  
+  mTailEngine.store(engine);
+  mFadingTailEngine.store(mFadingEngine);
+  
+  if(oldestEngine != nullptr)
+    retireEngine(oldestEngine);
+  if(oldEngine != nullptr)
+    retireEngine(oldEngine);
+}
+
+int ConvolutionReverb::crossfadeEngines(int numSamples, int nAvail)
+{
+  Engine& oldEngine = *mFadingEngine;
+  const int oldAvail = std::min(oldEngine.engine.Avail(numSamples), numSamples);
+  
+  if(oldAvail > 0 && oldEngine.tailOffset > 0)
+    mixTail(oldEngine, oldEngine.engine.Get(), oldAvail);
+  
+  // Both engines' output goes out at the end of the block, so the mix covers whichever has more, e.g. the
+  // old engine's alone while the new one has none yet
+  const int wetAvail = jmax(nAvail, oldAvail);
+  
+  if(wetAvail > 0)
+  {
+    // Equal power, with the gains interpolated linearly within the block
+    const int start = mFadePosition + numSamples - wetAvail;
+    const float inStart = getFadeInGain(start), inEnd = getFadeInGain(start + wetAvail);
+    const float outStart = getFadeOutGain(start), outEnd = getFadeOutGain(start + wetAvail);
+    
+    // Each side takes the matching channel of each engine; a mono engine's one channel stands for both
+    for (int chan = 0; chan < 2; ++chan)
+    {
+      const WDL_FFT_REAL* newConvo = nAvail > 0 ? mEngine->engine.Get()[jmin(chan, mEngine->numChannels - 1)] : nullptr;
+      const WDL_FFT_REAL* oldConvo = oldAvail > 0 ? oldEngine.engine.Get()[jmin(chan, oldEngine.numChannels - 1)] : nullptr;
+      float* mix = mCrossfadeBuffer.getWritePointer(chan);
+      
+      for (int i = 0; i < wetAvail; ++i)
+      {
+        const float t = (float) i / (float) wetAvail;
+        const int newIndex = i + nAvail - wetAvail;
+        const int oldIndex = i + oldAvail - wetAvail;
+        const float newSample = newIndex >= 0 ? newConvo[newIndex] : 0.f;
+        const float oldSample = oldIndex >= 0 ? oldConvo[oldIndex] : 0.f;
+        mix[i] = (inStart + t * (inEnd - inStart)) * newSample + (outStart + t * (outEnd - outStart)) * oldSample;
+      }
+    }
+  }
+  
+  oldEngine.engine.Advance(oldAvail);
+  mFadePosition += numSamples;
+  
+  if(mFadePosition >= mFadeLength)
+  {
+    mFadingTailEngine.store(nullptr);
+    retireEngine(mFadingEngine.release());
+  }
+  
+  return wetAvail;
+}
+
+void ConvolutionReverb::retireEngine(Engine* engine)
+{
+  // If the queue is full the retired engines are not being deleted. The tail thread may still be using
+  // the engine, so leak it rather than free it here.
+  if(!mAudioThreadToLoadThreadCallQueue.callf(std::bind(&ConvolutionReverb::deleteEngine, this, engine)))
+    jassertfalse;
+}
+
+void ConvolutionReverb::deleteEngine(Engine* engine)
+{
+  // mTailEngine and mFadingTailEngine have already moved on, so once the tail thread is out of its slice it is done with this one
+  const ScopedLock sl(mTailLock);
+  delete engine;
+}
+
+void ConvolutionReverb::setMonoInput(bool mono)
+{
+  if(mono == mMonoInput)
+    return;
+  
+  mMonoInput = mono;
+  
+  // Only mono IRs are built differently for it
+  if(mIRNumChannels == 1 && mIRNumSamples > 0)
+    startThread();
+}
+
+void ConvolutionReverb::setBackgroundTail(bool enable)
+{
+  mBackgroundTail = enable;
+}
+
+void ConvolutionReverb::addInput(Engine& engine, AudioBuffer<float>& buffer, const float* monoInput)
+{
+  const int numSamples = buffer.getNumSamples();
+  float* inputs[2] = { buffer.getWritePointer(0), buffer.getWritePointer(1) };
+  
+  if(engine.numChannels == 1)
+    inputs[0] = const_cast<float*>(monoInput != nullptr ? monoInput : mDownmix.getReadPointer(0));
+  else if(monoInput != nullptr)
+    inputs[0] = inputs[1] = const_cast<float*>(monoInput);
+  
+  engine.engine.Add(inputs, numSamples, engine.numChannels);
+  
+  if(engine.tailOffset > 0)
+    sendToTail(engine, inputs, numSamples);
+}
+
+void ConvolutionReverb::sendToTail(Engine& engine, float* const* inputs, int numSamples)
 {
-  mIRSampleRate = IRSampleRate;
-  mIR.SetNumChannels(numChans);
+  int start1, size1, start2, size2;
+  engine.tailInputFifo.prepareToWrite(numSamples, start1, size1, start2, size2);
+  
+  for (int chan = 0; chan < engine.numChannels; ++chan)
+  {
+    engine.tailInput.copyFrom(chan, start1, inputs[chan], size1);
+    if (size2 > 0)
+      engine.tailInput.copyFrom(chan, start2, inputs[chan] + size1, size2);
+  }
+  
+  engine.tailInputFifo.finishedWrite(size1 + size2);
+  mTailThread.moveToFrontOfQueue(this);
+  
+  // The tail thread is far behind: what did not fit will never have a tail
+  const int dropped = numSamples - (size1 + size2);
+  if (dropped > 0)
+  {
+    engine.tailSamplesToSkip -= dropped;
+    ++mNumLateTailBlocks;
+  }
+}
+
+void ConvolutionReverb::mixTail(Engine& engine, WDL_FFT_REAL** convo, int numSamples)
+{
+  AbstractFifo& fifo = engine.tailOutputFifo;
+  int offset = 0;
+  
+  if (engine.tailSamplesToSkip > 0)
+  {
+    const int skip = jmin(engine.tailSamplesToSkip, fifo.getNumReady());
+    fifo.finishedRead(skip);
+    engine.tailSamplesToSkip -= skip;
+  }
+  else if (engine.tailSamplesToSkip < 0)
+  {
+    offset = jmin(-engine.tailSamplesToSkip, numSamples);
+    engine.tailSamplesToSkip += offset;
+  }
   
-  //scoped pointer so old one gets deleted
-  mResampler = new r8b::CDSPResampler16IR(IRSampleRate, mSampleRate, cBlockLength);
+  int start1, size1, start2, size2;
+  fifo.prepareToRead(numSamples - offset, start1, size1, start2, size2);
   
-  // Resample the impulse response.
-  int impulseLength = mIR.SetLength(calcResampleLength(mIRAudioSampleBuffer->getNumSamples(), IRSampleRate, mSampleRate));
+  for (int chan = 0; chan < engine.numChannels; ++chan)
+  {
+    WDL_FFT_REAL* dest = convo[chan] + offset;
+    const float* src1 = engine.tailOutput.getReadPointer(chan, start1);
+    const float* src2 = engine.tailOutput.getReadPointer(chan, start2);
+    
+    for (int i = 0; i < size1; ++i)
+      *dest++ += src1[i];
+    for (int i = 0; i < size2; ++i)
+      *dest++ += src2[i];
+  }
   
-  if (impulseLength)
+  fifo.finishedRead(size1 + size2);
+  
+  // Missed the deadline: this block goes out without the rest of its tail, which is dropped on arrival
+  const int late = numSamples - offset - (size1 + size2);
+  if (late > 0)
   {
-    for(auto chan=0;chan<numChans;chan++)
-      resampleIR(mIRAudioSampleBuffer->getReadPointer(chan), mIRAudioSampleBuffer->getNumSamples(), IRSampleRate, mIR.impulses[chan].Get(), impulseLength, mSampleRate);
+    engine.tailSamplesToSkip += late;
+    ++mNumLateTailBlocks;
   }
+}
+
+int ConvolutionReverb::useTimeSlice()
+{
+  const ScopedLock sl(mTailLock);
+  deleteRetiredEngines();
+  
+  Engine* engines[] = { mTailEngine.load(), mFadingTailEngine.load() };
+  bool busy = false, hasTail = false;
   
-  // Tie the impulse response to the convolution engine.
-  mEngine.SetImpulse(&mIR);
+  for (Engine* engine : engines)
+  {
+    if (engine == nullptr || engine->tailOffset == 0)
+      continue;
+    
+    hasTail = true;
+    
+    const int numReady = engine->tailInputFifo.getNumReady();
+    if (numReady == 0)
+      continue;
+    
+    int start1, size1, start2, size2;
+    engine->tailInputFifo.prepareToRead(numReady, start1, size1, start2, size2);
+    convolveTail(*engine, start1, size1);
+    convolveTail(*engine, start2, size2);
+    engine->tailInputFifo.finishedRead(size1 + size2);
+    busy = true;
+  }
   
-  mImpulseLoaded = true;
-}
\ No newline at end of file
+  // sendToTail() wakes the thread; the poll only catches a wake that lands mid-slice, well inside the
+  // tail's deadline of at least cMinTailOffset samples. Without a tail it only has engines to free.
+  if (busy)
+    return 0;
+  
+  return hasTail ? 20 : 200;
+}
+
+void ConvolutionReverb::convolveTail(Engine& engine, int start, int numSamples)
+{
+  if (numSamples <= 0)
+    return;
+  
+  // In place: the input is not needed again
+  float* input[2];
+  for (int chan = 0; chan < engine.numChannels; ++chan)
+    input[chan] = engine.tailInput.getWritePointer(chan, start);
+  
+  engine.tail.process(input, input, numSamples);
+  
+  // The audio thread only falls this far behind if it stops, when nothing is waiting for the output anyway
+  int start1, size1, start2, size2;
+  engine.tailOutputFifo.prepareToWrite(numSamples, start1, size1, start2, size2);
+  
+  for (int chan = 0; chan < engine.numChannels; ++chan)
+  {
+    engine.tailOutput.copyFrom(chan, start1, input[chan], size1);
+    if (size2 > 0)
+      engine.tailOutput.copyFrom(chan, start2, input[chan] + size1, size2);
+  }
+  
+  engine.tailOutputFifo.finishedWrite(size1 + size2);
+}
@@ -20,8 +20,14 @@
 #include "r8brain/CDSPResampler.h"
 #include "nonblocking_call_queue.h"
 #include "ParameterSmoother.h"
+#include "PartitionedConvolver.h"
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
 
 class ConvolutionReverb : public Thread
+                        , private TimeSliceClient
 {
 public:
   ConvolutionReverb();
@@ -31,6 +37,8 @@ public:
   bool setPreferredBusArrangement (bool isInput, int bus, const AudioChannelSet& preferredSet);
 
   void processBlock(AudioBuffer<float> &buffer, MidiBuffer &midiMessages);
+  // Mixes in the reverb of monoInput rather than of the buffer, e.g. of a voice before it was panned
+  void processBlock(AudioBuffer<float> &buffer, const float* monoInput, MidiBuffer &midiMessages);
   
   //Thread
   void run() override;
@@ -46,38 +54,201 @@ public:
   void setWetLevel(float leveldB) { mWetLevel = Decibels::decibelsToGain(leveldB); }
   void setMix(float mix) { mDryLevel = cosf(mix*1.5708f); mWetLevel = sinf(mix*1.5708f); }
   
+  // Keeps IRs loaded from now on as 16-bit integers, each channel scaled to its peak, halving the memory
+  // of the copy held for resampling, which instances loading the same IR share. Only the resampled IR the
+  // engine uses is float.
+  void setCompactIRStorage(bool compact) { mCompactIRStorage = compact; }
+  
+  // Whether processBlock() will mostly be given a mono input. Mono IRs are then built to convolve one
+  // channel rather than two, halving the work; either kind of engine takes either input. Rebuilds the
+  // current IR on the loading thread if that changes, and the new engine crossfades in. Message thread.
+  void setMonoInput(bool mono);
+  
+  // Convolves all but the head of long IRs on a background thread, so that the long partitions, which
+  // come due every few blocks, no longer spike the audio callback. The tail is convolved in uniform
+  // partitions whose spectra instances share, see ResampledIR::getTailSpectra(). Applies to the engines
+  // built from then on (the next load or sample rate change), so best set before loading the first IR.
+  // The thread it runs on starts with the first engine, as it also frees old ones; each block with a
+  // tail wakes it, taking its queue lock for a moment.
+  void setBackgroundTail(bool enable);
+  // Blocks whose tail was not ready in time and went out without it
+  int getNumLateTailBlocks() const { return mNumLateTailBlocks.load(); }
+  
+  // A new IR fades in over this long while the previous one, still running, fades out. 0 switches at once.
+  void setCrossfadeTime(float timeMS) { mCrossfadeTime = timeMS; }
   
 private:
-  template <class I, class O> void resampleIR(const I* src, int srcLen, double srcRate, O* dest, int destLen, double destRate);
+  // Built by whichever instance asks the IRLibrary for it first, and never changed after, so instances share it
+  struct LibraryItem : public ReferenceCountedObject
+  {
+    LibraryItem() : built(true) {}
+    WaitableEvent built; // signalled once the item is filled in
+  };
+  
+  // An IR as read, before resampling: float, or 16-bit if compact
+  struct DecodedIR : public LibraryItem
+  {
+    typedef ReferenceCountedObjectPtr<DecodedIR> Ptr;
+    String source; // where the IR was read from, see run()
+    double sampleRate = 44100.;
+    int numChannels = 0, numSamples = 0; // numSamples is 0 if it could not be read
+    AudioSampleBuffer samples; // unless compact
+    HeapBlock<int16> compactSamples; // [chan][sample], if compact
+    HeapBlock<float> compactScales; // per channel
+    bool isCompact() const { return compactSamples != nullptr; }
+  };
+  
+  // An IR resampled for one sample rate
+  struct ResampledIR : public LibraryItem
+  {
+    typedef ReferenceCountedObjectPtr<ResampledIR> Ptr;
+    WDL_ImpulseBuffer ir;
+    
+    // The IR from tailOffset on, in partitions for the background tail's PartitionedConvolver. Made by the
+    // first engine to ask and shared by the others, while any uses them.
+    std::shared_ptr<const PartitionedConvolver::Spectra> getTailSpectra(int tailOffset, int partitionSize);
+    
+  private:
+    CriticalSection tailSpectraLock;
+    std::map<std::pair<int, int>, std::weak_ptr<const PartitionedConvolver::Spectra>> tailSpectra;
+  };
+  
+  /** Process-wide cache of decoded and resampled IRs, so that instances loading the same IR, e.g. the
+      embedded ones, decode it once, and at the same rate resample it once, and share them. The head's
+      partition spectra are built by each engine's SetImpulse(), as WDL keeps them inside the engine
+      along with its input history; the tail's are shared through the ResampledIR.
+      A decoded IR is kept while any instance has it loaded, a resampled one while any engine uses it.
+  */
+  class IRLibrary
+  {
+  public:
+    struct Key
+    {
+      String source; // where the IR was read from, see run()
+      int numChannels;
+      double sampleRate;
+      bool compact; // 16-bit copies resample to slightly different values
+      
+      bool operator< (const Key& other) const
+      {
+        return std::tie(source, numChannels, sampleRate, compact) < std::tie(other.source, other.numChannels, other.sampleRate, other.compact);
+      }
+    };
+    
+    // Calls resample to build the IR if it is not cached. The library is only locked to look the key up:
+    // the IR is built outside it, and other callers after the same key wait for that IR alone.
+    ResampledIR::Ptr get(const Key& key, std::function<void(ResampledIR&)> resample);
+    // The same for an IR as read from source, see DecodedIR
+    DecodedIR::Ptr getDecoded(const String& source, bool compact, std::function<void(DecodedIR&)> read);
+    
+  private:
+    template <class ItemKey, class Item>
+    ReferenceCountedObjectPtr<Item> getItem(std::map<ItemKey, ReferenceCountedObjectPtr<Item>>& items, const ItemKey& key, std::function<void(Item&)> build);
+    
+    CriticalSection mLock;
+    std::map<Key, ResampledIR::Ptr> mIRs;
+    std::map<std::pair<String, bool>, DecodedIR::Ptr> mDecodedIRs;
+  };
+  
+  // A resampled IR tied to its own convolution engine, so a whole new one can be built on the loading
+  // thread and swapped in by the audio thread.
+  struct Engine
+  {
+    Engine(int tailOffset, int numChannels);
+    
+    ResampledIR::Ptr ir;
+    WDL_ConvolutionEngine_Div engine; // the whole IR, or only its head if there is a tail
+    const int numChannels; // convolved and output: 1 for a mono IR fed mono, else 2
+    
+    // With a background tail, the IR from tailOffset on, convolved on mTailThread. Its output waits in a
+    // FIFO primed with silence, which with the convolver's latency delays it by tailOffset. The priming
+    // is the deadline for each block's tail.
+    const int tailOffset; // 0 if no tail
+    PartitionedConvolver tail;
+    AbstractFifo tailInputFifo, tailOutputFifo;
+    AudioSampleBuffer tailInput, tailOutput;
+    // Audio thread: tail samples to drop because their block went out without them, or if negative,
+    // samples to go out without a tail because their input did not fit in tailInputFifo
+    int tailSamplesToSkip;
+  };
+  
+  static constexpr int cMinTailOffset = 8192;
+  static constexpr float cDefaultCrossfadeTime = 500.f;
+  
+  template <class I, class O> void resampleIR(r8b::CDSPResampler16IR& resampler, const I* src, int srcLen, double srcRate, O* dest, int destLen, double destRate, double srcScale = 1.) const;
   
   inline int calcResampleLength(int srcLen, double srcRate, double destRate) const
   {
     return static_cast<int>(destRate / srcRate * static_cast<double>(srcLen) + 0.5);
   }
   
-  void updateConvoEngineIR(int numChans, double IRSampleRate);
+  // Takes the IR read from stream out of the library, or decodes it there, and loads it. Keeps the IR
+  // loaded until then if the stream can't be read.
+  void readIR(const String& source, InputStream* stream);
+  // Resamples, partitions and transforms the loaded IR for mSampleRate, for a mono or stereo input.
+  // Never call on the audio thread.
+  Engine* createEngine(bool monoInput) const;
+  // Hands a new engine to the audio thread, which swaps it in at its next block
+  void postEngine(Engine* engine);
+  // Audio thread: the old engine goes back to be deleted off the audio thread
+  void swapEngine(Engine* engine);
+  // Mixes the outgoing engine's output with the new one's into mCrossfadeBuffer; returns how many samples,
+  // at the end of the block, are wet
+  int crossfadeEngines(int numSamples, int nAvail);
+  float getFadeInGain(int position) const { return sinf(jmin(1.f, (float) position / (float) mFadeLength) * 1.5708f); }
+  float getFadeOutGain(int position) const { return mFadeOutStart * cosf(jmin(1.f, (float) position / (float) mFadeLength) * 1.5708f); }
+  void retireEngine(Engine* engine);
+  // Deletes the engines the audio thread has swapped out. Any thread but the audio thread: the lock keeps
+  // the queue to one reader at a time.
+  void deleteRetiredEngines() { const ScopedLock sl(mTailLock); mAudioThreadToLoadThreadCallQueue.synchronize(); }
+  void deleteEngine(Engine* engine);
+  
+  // Feeds an engine the mono input if there is one, or the buffer
+  void addInput(Engine& engine, AudioBuffer<float>& buffer, const float* monoInput);
+  
+  // Audio thread side of the background tail
+  void sendToTail(Engine& engine, float* const* inputs, int numSamples);
+  void mixTail(Engine& engine, WDL_FFT_REAL** convo, int numSamples);
+  // Tail thread side
+  int useTimeSlice() override;
+  void convolveTail(Engine& engine, int start, int numSamples);
   
 private:
   double mSampleRate;
-  double mIRSampleRate;
+  int mBlockSize;
   static constexpr int cBlockLength = 64;
   static constexpr int cSmoothTime = 1.;
   File mFile;
   const void* mSourceData = nullptr;
   size_t mSourceDataSize = 0;
   
-  WDL_ImpulseBuffer mIR;
-  WDL_ConvolutionEngine_Div mEngine;
-  ScopedPointer<r8b::CDSPResampler16IR> mResampler;
-  ScopedPointer<AudioSampleBuffer> mIRAudioSampleBuffer;
+  ScopedPointer<Engine> mEngine; // owned by the audio thread
+  ScopedPointer<Engine> mFadingEngine; // the previous engine while it fades out, also the audio thread's
+  std::atomic<Engine*> mTailEngine, mFadingTailEngine; // both, for the tail thread
+  CriticalSection mTailLock; // held by the tail thread while it uses mTailEngine, never by the audio thread
+  TimeSliceThread mTailThread; // convolves the tails and frees retired engines
+  std::atomic<int> mNumLateTailBlocks;
+  SharedResourcePointer<IRLibrary> mIRLibrary;
+  DecodedIR::Ptr mDecodedIR; // the IR last read
+  std::atomic<int> mIRNumChannels; // mDecodedIR's, written by the loader, read by setMonoInput()
+  std::atomic<int> mIRNumSamples;
   LockFreeCallQueue mLoadThreadToAudioThreadCallQueue;
+  LockFreeCallQueue mAudioThreadToLoadThreadCallQueue;
   ParameterSmoother mDryLevelSmoother;
   ParameterSmoother mWetLevelSmoother;
   
   float mDryLevel;
   float mWetLevel;
   
-  bool mImpulseLoaded;
+  float mCrossfadeTime;
+  int mFadePosition, mFadeLength; // audio thread
+  float mFadeOutStart;
+  
+  bool mCompactIRStorage;
+  bool mBackgroundTail;
+  std::atomic<bool> mMonoInput; // set on the message thread, read by the loader
+  AudioSampleBuffer mDownmix; // the buffer's channels summed, for a mono engine not given a mono input
+  AudioSampleBuffer mCrossfadeBuffer; // both engines' output, mixed, while one fades into the other
 };
 
 #endif  // CONVOLUTIONREVERB_H_INCLUDED
@@ -0,0 +1,135 @@
+/*
+  ==============================================================================
+
+    PartitionedConvolver.cpp
+
+  ==============================================================================
+*/
+
+#include "PartitionedConvolver.h"
+#include "BinauralPanner/VectorOps.h"
+#include <algorithm>
+#include <cassert>
+
+std::shared_ptr<const PartitionedConvolver::Spectra> PartitionedConvolver::createSpectra(const float* const* irs, int numChannels, int irLength, int partitionSize)
+{
+  assert(isPowerOf2(partitionSize) && numChannels > 0);
+
+  auto spectra = std::make_shared<Spectra>();
+  spectra->partitionSize = partitionSize;
+  spectra->numBins = partitionSize + 1;
+  spectra->numPartitions = std::max(1, (irLength + partitionSize - 1) / partitionSize);
+  spectra->numChannels = numChannels;
+  spectra->data.resize(numChannels * spectra->numPartitions * spectra->numBins);
+
+  const auto fft = FFT::create(2 * partitionSize);
+  std::vector<float> zeroPadded(2 * partitionSize);
+
+  for (int chan = 0; chan < numChannels; ++chan)
+  {
+    for (int partition = 0; partition < spectra->numPartitions; ++partition)
+    {
+      const int start = partition * partitionSize;
+      const int end = std::min(start + partitionSize, irLength);
+      std::fill(zeroPadded.begin(), zeroPadded.end(), 0.f);
+      std::copy(irs[chan] + start, irs[chan] + end, zeroPadded.begin());
+      fft->fft(zeroPadded.data(), &spectra->data[(chan * spectra->numPartitions + partition) * spectra->numBins]);
+    }
+  }
+
+  return spectra;
+}
+
+void PartitionedConvolver::prepare(std::shared_ptr<const Spectra> spectra, int numChannels)
+{
+  assert(spectra != nullptr && numChannels > 0 && numChannels <= cMaxChannels);
+  mSpectra = spectra;
+  mNumChannels = numChannels;
+  mFFT = FFT::create(2 * mSpectra->partitionSize);
+
+  for (int chan = 0; chan < cMaxChannels; ++chan)
+  {
+    const bool used = chan < mNumChannels;
+    mInput[chan].resize(used ? 2 * mSpectra->partitionSize : 0);
+    mInputDFTs[chan].resize(used ? mSpectra->numPartitions * mSpectra->numBins : 0);
+    mOutputDFT[chan].resize(used ? mSpectra->numBins : 0);
+    mOutput[chan].resize(used ? 2 * mSpectra->partitionSize : 0);
+  }
+
+  reset();
+}
+
+void PartitionedConvolver::process(const float* const* in, float* const* out, int numSamples)
+{
+  // The output lags input by one partition: each sample taken in swaps with one from the partition
+  // processed before
+  const int partitionSize = mSpectra->partitionSize;
+  const float scale = 2.f / (2 * partitionSize);
+
+  for (int pos = 0; pos < numSamples;)
+  {
+    const int n = std::min(numSamples - pos, partitionSize - mPartitionPosition);
+
+    for (int chan = 0; chan < mNumChannels; ++chan)
+    {
+      std::copy(in[chan] + pos, in[chan] + pos + n, getInputHalf(chan, mNewestHalf) + mPartitionPosition);
+
+      const float* output = mOutput[chan].data() + partitionSize + mPartitionPosition;
+      for (int i = 0; i < n; ++i)
+        out[chan][pos + i] = scale * output[i];
+    }
+
+    mPartitionPosition += n;
+    pos += n;
+
+    if (mPartitionPosition == partitionSize)
+    {
+      processPartition();
+      mPartitionPosition = 0;
+      mNewestHalf ^= 1;
+    }
+  }
+}
+
+void PartitionedConvolver::processPartition()
+{
+  const int numBins = mSpectra->numBins;
+  const int numPartitions = mSpectra->numPartitions;
+  mNewestInputDFT = (mNewestInputDFT + 1) % numPartitions;
+
+  for (int chan = 0; chan < mNumChannels; ++chan)
+  {
+    // overlap-save: the frame holds the previous and the newest partition, as in HRIRFilter
+    ComplexVector<float>& inputDFTs = mInputDFTs[chan];
+    mFFT->fft(getInputHalf(chan, mNewestHalf ^ 1), getInputHalf(chan, mNewestHalf), &inputDFTs[mNewestInputDFT * numBins]);
+
+    // Partition k of the IR applies to the frame k partitions old
+    const int irChannel = std::min(chan, mSpectra->numChannels - 1);
+    VectorOps::complexMultiply(&inputDFTs[mNewestInputDFT * numBins], mSpectra->get(irChannel, 0), 1.f, mOutputDFT[chan].data(), numBins);
+    for (int k = 1; k < numPartitions; ++k)
+    {
+      const int frame = (mNewestInputDFT - k + numPartitions) % numPartitions;
+      VectorOps::complexMultiplyAdd(&inputDFTs[frame * numBins], mSpectra->get(irChannel, k), mOutputDFT[chan].data(), numBins);
+    }
+  }
+
+  // The first half of the result is aliased, process() plays out the second
+  if (mNumChannels == 2)
+    mFFT->ifftPair(mOutputDFT[0].data(), mOutputDFT[1].data(), mOutput[0].data(), mOutput[1].data());
+  else
+    mFFT->ifft(mOutputDFT[0].data(), mOutput[0].data());
+}
+
+void PartitionedConvolver::reset()
+{
+  for (int chan = 0; chan < mNumChannels; ++chan)
+  {
+    std::fill(mInput[chan].begin(), mInput[chan].end(), 0.f);
+    std::fill(mInputDFTs[chan].begin(), mInputDFTs[chan].end(), std::complex<float>());
+    std::fill(mOutput[chan].begin(), mOutput[chan].end(), 0.f);
+  }
+
+  mNewestHalf = 0;
+  mNewestInputDFT = 0;
+  mPartitionPosition = 0;
+}
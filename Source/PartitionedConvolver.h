@@ -0,0 +1,69 @@
+/*
+  ==============================================================================
+
+    PartitionedConvolver.h
+
+  ==============================================================================
+*/
+
+#ifndef PARTITIONEDCONVOLVER_H_INCLUDED
+#define PARTITIONEDCONVOLVER_H_INCLUDED
+
+#include "BinauralPanner/FFT.h"
+#include "BinauralPanner/Util.h"
+#include <memory>
+#include <vector>
+
+/** Uniformly partitioned overlap-save convolution of one or two channels with a fixed IR, as in HRIRFilter
+    but with its partition spectra made once and shared: any number of convolvers can run off one Spectra,
+    each keeping only its own input history. Used by ConvolutionReverb for the background tail, whose
+    spectra the instances sharing an IR share too. Input is gathered into whole partitions, so process()
+    takes any number of samples, at a latency of one partition.
+*/
+class PartitionedConvolver
+{
+public:
+  // A multichannel IR cut into partitions, each zero padded to twice its size and transformed
+  struct Spectra
+  {
+    int partitionSize;
+    int numBins; // partitionSize + 1
+    int numPartitions;
+    int numChannels;
+    ComplexVector<float> data; // [channel][partition][bin]
+
+    const std::complex<float>* get(int channel, int partition) const
+    {
+      return data.data() + (channel * numPartitions + partition) * numBins;
+    }
+  };
+
+  // irs holds numChannels IRs of irLength samples; partitionSize must be a power of 2
+  static std::shared_ptr<const Spectra> createSpectra(const float* const* irs, int numChannels, int irLength, int partitionSize);
+
+  // Allocates. Channel i of the input is convolved with channel i of the IR, or its last if it has fewer.
+  void prepare(std::shared_ptr<const Spectra> spectra, int numChannels);
+  // out may be the same buffers as in
+  void process(const float* const* in, float* const* out, int numSamples);
+  int getLatency() const { return mSpectra != nullptr ? mSpectra->partitionSize : 0; }
+  void reset();
+
+private:
+  void processPartition();
+  float* getInputHalf(int channel, int half) { return mInput[channel].data() + half * mSpectra->partitionSize; }
+
+  static constexpr int cMaxChannels = 2;
+
+  std::shared_ptr<const Spectra> mSpectra;
+  std::unique_ptr<FFT> mFFT;
+  int mNumChannels = 0;
+  std::vector<float> mInput[cMaxChannels]; // rings of two partitions, the newest gathered into mNewestHalf
+  ComplexVector<float> mInputDFTs[cMaxChannels]; // spectra of the last numPartitions frames, [frame][bin]
+  ComplexVector<float> mOutputDFT[cMaxChannels];
+  std::vector<float> mOutput[cMaxChannels]; // second half is the output of the last partition
+  int mNewestHalf = 0;
+  int mNewestInputDFT = 0;
+  int mPartitionPosition = 0; // samples gathered into the current partition
+};
+
+#endif  // PARTITIONEDCONVOLVER_H_INCLUDED
@@ -49,7 +49,11 @@ SpatialPodcastAudioProcessor::SpatialPodcastAudioProcessor()
   mDistanceToFilteredBPF = new BreakPointFunction(mDistanceToFilteredMapping);
 
   mAPVTS.addParameterListener("ContentType", this);
+  mAPVTS.addParameterListener("InputType", this);
 
+  mConvolutionReverb.setBackgroundTail(true);
+  mConvolutionReverb.setMonoInput(isMonoVoice());
+  
   //narration defaults
   mConvolutionReverb.loadNewIRFromMemory(BinaryData::koli_summer_site1_4way_mono_wav, BinaryData::koli_summer_site1_4way_mono_wavSize);
   mFilter.setFrequency(100.f);
@@ -87,11 +91,24 @@ SpatialPodcastAudioProcessor::~SpatialPodcastAudioProcessor()
 
 void SpatialPodcastAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
 {
+  mConvolutionReverb.setMonoInput(isMonoVoice());
   mConvolutionReverb.prepareToPlay(sampleRate, samplesPerBlock);
+  mMonoReverbInput.setSize(1, samplesPerBlock);
   mMonoBinauralPanner.prepareToPlay(sampleRate, samplesPerBlock);
   mStereoBinauralPanner.prepareToPlay(sampleRate, samplesPerBlock);
   mFilter.prepareToPlay(sampleRate, samplesPerBlock);
   mPanner.prepareToPlay(sampleRate, samplesPerBlock);
+  
+  // the binaural panners' partitioned convolution delays the signal; the other paths and the
+  // reverb's mono feed are delayed to match, so the reported latency holds whichever is active
+  const int latency = mMonoBinauralPanner.getLatencySamples();
+  for(auto* delay : { &mPathDelay[0], &mPathDelay[1], &mReverbInputDelay })
+  {
+    delay->prepare((float) latency);
+    delay->setDelay((float) latency);
+    delay->reset();
+  }
+  setLatencySamples(latency);
 }
 
 void SpatialPodcastAudioProcessor::releaseResources()
@@ -131,6 +148,25 @@ void SpatialPodcastAudioProcessor::processBlock (AudioSampleBuffer& buffer, Midi
   mStereoBinauralPanner.setWidth(pan * 180.f);
   mStereoBinauralPanner.setElevation(elevation);
   
+  // A mono voice is filtered before it is panned, so that the reverb can take it mono: half the convolution
+  const bool monoVoice = isMonoVoice();
+  
+  //TODO: !! accessing the BPFs here is not thread safe, because it is accessing a valuetree
+  mFilter.setMix(mDistanceToFilteredBPF->getYforX(distance));
+  
+  if(monoVoice)
+  {
+    // Feed the reverb at the level the panner spreads the voice at, whatever the pan: the binaural
+    // panner halves it, the sqrt panner keeps its power, so 1/sqrt(2) a side
+    const float reverbInputGain = pannerType == kBinaural ? 0.5f : pannerType == kSqrt ? std::sqrt(0.5f) : 1.f;
+    
+    mFilter.processBlock(buffer);
+    mMonoReverbInput.setSize(1, buffer.getNumSamples(), false, false, true);
+    mMonoReverbInput.copyFrom(0, 0, buffer.getReadPointer(0), buffer.getNumSamples(), reverbInputGain);
+    if(getLatencySamples() > 0)
+      mReverbInputDelay.process(mMonoReverbInput.getWritePointer(0), buffer.getNumSamples());
+  }
+  
   if(contentType != kMusic)
   {
     if(pannerType == kBinaural)
@@ -151,12 +187,26 @@ void SpatialPodcastAudioProcessor::processBlock (AudioSampleBuffer& buffer, Midi
     }
   }
   
-  //TODO: !! accessing the BPFs here is not thread safe, because it is accessing a valuetree
-  mFilter.setMix(mDistanceToFilteredBPF->getYforX(distance));
-  mFilter.processBlock(buffer);
+  if((contentType == kMusic || pannerType != kBinaural) && getLatencySamples() > 0)
+  {
+    for(int chan = 0; chan < jmin(buffer.getNumChannels(), 2); chan++)
+      mPathDelay[chan].process(buffer.getWritePointer(chan), buffer.getNumSamples());
+  }
+  
+  if(!monoVoice)
+    mFilter.processBlock(buffer);
+  
   mConvolutionReverb.setDryLevel(mDistanceToDryBPF->getYforX(distance));
   mConvolutionReverb.setWetLevel(mDistanceToWetBPF->getYforX(distance));
-  mConvolutionReverb.processBlock(buffer, midiMessages);
+  mConvolutionReverb.processBlock(buffer, monoVoice ? mMonoReverbInput.getReadPointer(0) : nullptr, midiMessages);
+}
+
+bool SpatialPodcastAudioProcessor::isMonoVoice()
+{
+  const int inputType = mAPVTS.getParameter("InputType")->getValue();
+  const EContentType contentType = (EContentType) (int) *mAPVTS.getRawParameterValue("ContentType");
+  
+  return contentType != kMusic && (inputType == kMono || getTotalNumInputChannels() == 1);
 }
 
 AudioProcessorEditor* SpatialPodcastAudioProcessor::createEditor()
@@ -372,6 +422,10 @@ void SpatialPodcastAudioProcessor::parameterChanged (const String& parameterID,
         break;
     }
   }
+  
+  // after any new IR has started loading, which then picks this up
+  if(parameterID == "ContentType" || parameterID == "InputType")
+    mConvolutionReverb.setMonoInput(isMonoVoice());
 }
 
 
@@ -12,6 +12,7 @@
 #include "Panner.h"
 #include "BinauralPanner/BinauralPanner.h"
 #include "BinauralPanner/StereoBinauralPanner.h"
+#include "BinauralPanner/FractionalDelay.h"
 #include "TrapezoidalSVF.h"
 #include "value_tree_debugger.h"
 #include "BreakPointFunction.h"
@@ -82,11 +83,16 @@ public:
   void setStateInformation (const void* data, int sizeInBytes) override;
   
   void parameterChanged (const String& parameterID, float newValue) override;
+  // Whether the voice comes in mono and is panned, so the reverb can take it before panning
+  bool isMonoVoice();
     
   ConvolutionReverb mConvolutionReverb;
   BinauralPanner mMonoBinauralPanner;
   StereoBinauralPanner mStereoBinauralPanner;
   TrapezoidalSVF mFilter;
+  AudioSampleBuffer mMonoReverbInput;
+  FractionalDelay mPathDelay[2]; // keeps the paths without a binaural panner at its latency
+  FractionalDelay mReverbInputDelay;
   AudioProcessorValueTreeState mAPVTS;
   ValueTree mDistanceToDryMapping = ValueTree("DistanceToDryMapping");
   ValueTree mDistanceToWetMapping = ValueTree("DistanceToWetMapping");
@@ -0,0 +1,164 @@
+/*
+  ==============================================================================
+
+    TailSplitCheck.cpp
+
+    Checks ConvolutionReverb's background tail against WDL itself: one
+    WDL_ConvolutionEngine_Div given the whole IR must match a head engine given
+    the IR up to tailOffset plus a PartitionedConvolver given the rest, with the
+    tail's output delayed by tailOffset less its latency, as the tail FIFO's
+    priming delays it. Both are set up as in ConvolutionReverb::createEngine().
+    Also times each block of the whole engine and of the head, the part left in
+    the audio callback, and of the tail, the tail thread's part, and reports
+    their peaks against their averages.
+    Returns non-zero if the outputs disagree.
+
+    Build it against the WDL checkout the .jucer points at, with its defines:
+
+      c++ -std=c++11 -O2 -DWDL_CONVO_THREAD -I../WDL -I.. -o tailsplitcheck TailSplitCheck.cpp \
+        ../PartitionedConvolver.cpp ../BinauralPanner/FFT.cpp ../BinauralPanner/FloatFFT.cpp \
+        ../BinauralPanner/OouraFFT.cpp ../BinauralPanner/VectorOps.cpp \
+        ../WDL/WDL/convoengine.cpp ../WDL/WDL/fft.c -lpthread
+      ./tailsplitcheck [IR seconds] [block size]
+
+  ==============================================================================
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "WDL/convoengine.h"
+#include "PartitionedConvolver.h"
+
+namespace
+{
+	const double sampleRate = 48000.;
+	const int minTailOffset = 8192; // ConvolutionReverb::cMinTailOffset
+	const int numChannels = 2;
+
+	struct BlockTimes
+	{
+		double total = 0., peak = 0.;
+		int count = 0;
+
+		void add(double us)
+		{
+			total += us;
+			peak = std::max(peak, us);
+			++count;
+		}
+
+		double average() const { return count > 0 ? total / count : 0.; }
+	};
+
+	// Feeds a block through an engine and appends what it returns to out; returns the time taken
+	double process(WDL_ConvolutionEngine_Div& engine, WDL_FFT_REAL** input, int blockSize, std::vector<float> (&out)[numChannels])
+	{
+		const auto start = std::chrono::steady_clock::now();
+		engine.Add(input, blockSize, numChannels);
+		const auto avail = engine.Avail(blockSize);
+		if (avail > 0)
+		{
+			auto** convo = engine.Get();
+			for (auto chan = 0; chan < numChannels; ++chan)
+				out[chan].insert(out[chan].end(), convo[chan], convo[chan] + avail);
+			engine.Advance(avail);
+		}
+		return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	const auto seconds = argc > 1 ? atof(argv[1]) : 3.;
+	const auto blockSize = argc > 2 ? atoi(argv[2]) : 256;
+	const auto irLength = static_cast<int>(seconds * sampleRate);
+	const auto tailOffset = std::max(minTailOffset, 4 * nextPowerOf2(blockSize));
+	if (irLength <= 2 * tailOffset)
+	{
+		printf("An IR of %d samples is too short for a tail at %d\n", irLength, tailOffset);
+		return 1;
+	}
+
+	// A decaying noise burst stands in for a room
+	std::mt19937 random(1);
+	std::normal_distribution<float> normal;
+	WDL_ImpulseBuffer ir;
+	ir.SetNumChannels(numChannels);
+	ir.SetLength(irLength);
+	for (auto chan = 0; chan < numChannels; ++chan)
+		for (auto i = 0; i < irLength; ++i)
+			ir.impulses[chan].Get()[i] = 0.05f * normal(random) * std::exp(-3.f * i / irLength);
+
+	WDL_ConvolutionEngine_Div whole, head;
+	whole.SetImpulse(&ir);
+	head.SetImpulse(&ir, 0, 0, tailOffset);
+
+	const float* tails[numChannels];
+	for (auto chan = 0; chan < numChannels; ++chan)
+		tails[chan] = ir.impulses[chan].Get() + tailOffset;
+	PartitionedConvolver tail;
+	tail.prepare(PartitionedConvolver::createSpectra(tails, numChannels, irLength - tailOffset, tailOffset / 2), numChannels);
+	const auto tailDelay = tailOffset - tail.getLatency();
+
+	// Long enough for the whole IR to have come out once
+	const auto numBlocks = (irLength + tailOffset) / blockSize + 16;
+	std::vector<float> input[numChannels], wholeOut[numChannels], headOut[numChannels], tailOut[numChannels];
+	std::uniform_real_distribution<float> uniform(-1.f, 1.f);
+	for (auto chan = 0; chan < numChannels; ++chan)
+	{
+		input[chan].resize(numBlocks * blockSize);
+		for (auto& x : input[chan])
+			x = uniform(random);
+	}
+
+	for (auto& out : tailOut)
+		out.resize(numBlocks * blockSize);
+
+	BlockTimes wholeTimes, headTimes, tailTimes;
+	for (auto block = 0; block < numBlocks; ++block)
+	{
+		WDL_FFT_REAL* in[numChannels];
+		float* out[numChannels];
+		for (auto chan = 0; chan < numChannels; ++chan)
+		{
+			in[chan] = input[chan].data() + block * blockSize;
+			out[chan] = tailOut[chan].data() + block * blockSize;
+		}
+		wholeTimes.add(process(whole, in, blockSize, wholeOut));
+		headTimes.add(process(head, in, blockSize, headOut));
+
+		const auto start = std::chrono::steady_clock::now();
+		tail.process(in, out, blockSize);
+		tailTimes.add(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+	}
+
+	// Compare as far as all three have output
+	auto length = std::min(wholeOut[0].size(), headOut[0].size());
+	length = std::min(length, tailOut[0].size() + tailDelay);
+	auto peak = 0.f, worst = 0.f;
+	for (auto chan = 0; chan < numChannels; ++chan)
+	{
+		for (size_t i = 0; i < length; ++i)
+		{
+			const auto split = headOut[chan][i] + (i >= static_cast<size_t>(tailDelay) ? tailOut[chan][i - tailDelay] : 0.f);
+			peak = std::max(peak, std::abs(wholeOut[chan][i]));
+			worst = std::max(worst, std::abs(split - wholeOut[chan][i]));
+		}
+	}
+
+	const auto tolerance = 1e-4f * peak;
+	const auto failed = length < static_cast<size_t>(irLength) || worst > tolerance;
+	printf("IR %d samples, blocks of %d, tail from %d: %zu samples compared, worst difference %.3g (peak %.3g)\n",
+		irLength, blockSize, tailOffset, length, worst, peak);
+	printf("%-12s %10s %10s %8s   (us per block)\n", "", "average", "peak", "ratio");
+	printf("%-12s %10.1f %10.1f %8.1f\n", "whole IR", wholeTimes.average(), wholeTimes.peak, wholeTimes.peak / wholeTimes.average());
+	printf("%-12s %10.1f %10.1f %8.1f\n", "head only", headTimes.average(), headTimes.peak, headTimes.peak / headTimes.average());
+	printf("%-12s %10.1f %10.1f %8.1f   (tail thread)\n", "tail", tailTimes.average(), tailTimes.peak, tailTimes.peak / tailTimes.average());
+	printf("%s\n", failed ? "FAILED" : "ok");
+	return failed ? 1 : 0;
+}